@@ -5,6 +5,7 @@ QML_FILES = \
 
 HEADERS += \
     $$PWD/qquickcalendar_p.h \
+    $$PWD/qquickcalendarcache_p.h \
     $$PWD/qquickcalendarmodel_p.h \
     $$PWD/qquickdayofweekmodel_p.h \
     $$PWD/qquickdayofweekrow_p.h \
@@ -15,6 +16,7 @@ HEADERS += \
 
 SOURCES += \
     $$PWD/qquickcalendar.cpp \
+    $$PWD/qquickcalendarcache.cpp \
     $$PWD/qquickcalendarmodel.cpp \
     $$PWD/qquickdayofweekmodel.cpp \
     $$PWD/qquickdayofweekrow.cpp \
@@ -0,0 +1,107 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Calendar module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickcalendarcache_p.h"
+
+#include <QtCore/qcache.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qhash.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+    static const int daysOnACalendarMonth = 7 * 6;
+
+    // Indexed by cell; a row that does not start on a Monday spans two ISO weeks.
+    struct WeekNumbers {
+        int numbers[daysOnACalendarMonth];
+    };
+}
+
+QQuickCalendarDayNames QQuickCalendarCache::dayNames(const QLocale &locale)
+{
+    static QHash<QLocale, QQuickCalendarDayNames> cache;
+
+    auto it = cache.constFind(locale);
+    if (it == cache.constEnd()) {
+        QQuickCalendarDayNames names;
+        for (int day = Qt::Monday; day <= Qt::Sunday; ++day) {
+            names.longNames[day - 1] = locale.standaloneDayName(day, QLocale::LongFormat);
+            names.shortNames[day - 1] = locale.standaloneDayName(day, QLocale::ShortFormat);
+            names.narrowNames[day - 1] = locale.standaloneDayName(day, QLocale::NarrowFormat);
+        }
+        it = cache.insert(locale, names);
+    }
+    return it.value();
+}
+
+void QQuickCalendarCache::weekNumbers(int year, int month, Qt::DayOfWeek firstDayOfWeek, int *weekNumbers)
+{
+    // scrolling through the years would otherwise grow the cache without bounds
+    static QCache<qint64, WeekNumbers> cache(1024);
+
+    const qint64 key = (qint64(year) * 12 + month) * 8 + firstDayOfWeek;
+    WeekNumbers *cached = cache.object(key);
+    if (!cached) {
+        cached = new WeekNumbers;
+
+        // The actual first (1st) day of the month.
+        QDate firstDayOfMonthDate(year, month, 1);
+        int difference = ((firstDayOfMonthDate.dayOfWeek() - firstDayOfWeek) + 7) % 7;
+        // The first day to display should never be the 1st of the month, as we want some days from
+        // the previous month to be visible.
+        if (difference == 0)
+            difference += 7;
+
+        // The week number only changes on Mondays.
+        const QDate firstDayDate = firstDayOfMonthDate.addDays(-difference);
+        int dayOfWeek = firstDayDate.dayOfWeek();
+        cached->numbers[0] = firstDayDate.weekNumber();
+        for (int i = 1; i < daysOnACalendarMonth; ++i) {
+            dayOfWeek = dayOfWeek % 7 + 1;
+            if (dayOfWeek == Qt::Monday)
+                cached->numbers[i] = firstDayDate.addDays(i).weekNumber();
+            else
+                cached->numbers[i] = cached->numbers[i - 1];
+        }
+        cache.insert(key, cached);
+    }
+
+    for (int i = 0; i < daysOnACalendarMonth; ++i)
+        weekNumbers[i] = cached->numbers[i];
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,77 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Calendar module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKCALENDARCACHE_P_H
+#define QQUICKCALENDARCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qlocale.h>
+#include <QtCore/qstring.h>
+
+QT_BEGIN_NAMESPACE
+
+struct QQuickCalendarDayNames
+{
+    // indexed by Qt::DayOfWeek - 1
+    QString longNames[7];
+    QString shortNames[7];
+    QString narrowNames[7];
+};
+
+// Process-wide caches shared by all calendar models, so that the week numbers
+// of a month and the localized day names are computed only once no matter how
+// many MonthGrid, WeekNumberColumn and DayOfWeekRow instances show them.
+class QQuickCalendarCache
+{
+public:
+    static QQuickCalendarDayNames dayNames(const QLocale &locale);
+    // fills the ISO week numbers of the 6 * 7 days shown for the month
+    static void weekNumbers(int year, int month, Qt::DayOfWeek firstDayOfWeek, int *weekNumbers);
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKCALENDARCACHE_P_H
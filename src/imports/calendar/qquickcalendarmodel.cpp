@@ -90,10 +90,11 @@ class QQuickCalendarModelPrivate : public QAbstractItemModelPrivate
 
 public:
     QQuickCalendarModelPrivate() : complete(false),
-        from(1,1,1), to(275759, 9, 25), count(0)
+        from(1,1,1), to(275759, 9, 25), first(0), count(0)
     {
     }
 
+    static int monthIndex(const QDate &date);
     static int getCount(const QDate& from, const QDate &to);
 
     void populate(const QDate &from, const QDate &to, bool force = false);
@@ -101,24 +102,24 @@ public:
     bool complete;
     QDate from;
     QDate to;
+    int first;
     int count;
 };
 
+// The number of months since January of year 1. There is no year 0, so the
+// months of the years before Christ map to negative values without a gap.
+int QQuickCalendarModelPrivate::monthIndex(const QDate &date)
+{
+    const int year = date.year();
+    return (year > 0 ? year - 1 : year) * 12 + date.month() - 1;
+}
+
 int QQuickCalendarModelPrivate::getCount(const QDate& from, const QDate &to)
 {
     if (!from.isValid() || !to.isValid())
         return 0;
 
-    QDate f(from.year(), from.month(), 1);
-    QDate t(to.year(), to.month(), to.daysInMonth());
-    int days = f.daysTo(t);
-    if (days < 0)
-        return 0;
-
-    QDate r = QDate(1, 1, 1).addDays(days);
-    int years = r.year() - 1;
-    int months = r.month() - 1;
-    return 12 * years + months + (r.day() / t.day());
+    return qMax(0, monthIndex(to) - monthIndex(from) + 1);
 }
 
 void QQuickCalendarModelPrivate::populate(const QDate &f, const QDate &t, bool force)
@@ -127,15 +128,45 @@ void QQuickCalendarModelPrivate::populate(const QDate &f, const QDate &t, bool f
     if (!force && f == from && t == to)
         return;
 
-    int c = getCount(from, to);
-    if (c != count) {
+    const int c = getCount(f, t);
+    const int newFirst = f.isValid() ? monthIndex(f) : 0;
+    const int newLast = newFirst + c - 1;
+    const int oldCount = count;
+
+    if (force || !count || !c || newFirst > first + count - 1 || newLast < first) {
         q->beginResetModel();
+        first = newFirst;
         count = c;
         q->endResetModel();
-        emit q->countChanged();
     } else {
-        emit q->dataChanged(q->index(0, 0), q->index(c - 1, 0));
+        // Report the months that were added or removed at either end of the
+        // range, so that views keep the delegates of the remaining months.
+        if (newFirst > first) {
+            q->beginRemoveRows(QModelIndex(), 0, newFirst - first - 1);
+            count -= newFirst - first;
+            first = newFirst;
+            q->endRemoveRows();
+        }
+        if (newLast < first + count - 1) {
+            q->beginRemoveRows(QModelIndex(), newLast - first + 1, count - 1);
+            count = newLast - first + 1;
+            q->endRemoveRows();
+        }
+        if (newFirst < first) {
+            q->beginInsertRows(QModelIndex(), 0, first - newFirst - 1);
+            count += first - newFirst;
+            first = newFirst;
+            q->endInsertRows();
+        }
+        if (newLast > first + count - 1) {
+            q->beginInsertRows(QModelIndex(), count, c - 1);
+            count = c;
+            q->endInsertRows();
+        }
     }
+
+    if (count != oldCount)
+        emit q->countChanged();
 }
 
 QQuickCalendarModel::QQuickCalendarModel(QObject *parent) :
@@ -160,6 +191,8 @@ void QQuickCalendarModel::setFrom(const QDate &from)
     if (d->from != from) {
         if (d->complete)
             d->populate(from, d->to);
+        else if (from.isValid())
+            d->first = d->monthIndex(from);
         d->from = from;
         emit fromChanged();
     }
@@ -195,7 +228,8 @@ void QQuickCalendarModel::setTo(const QDate &to)
 int QQuickCalendarModel::monthAt(int index) const
 {
     Q_D(const QQuickCalendarModel);
-    return d->from.addMonths(index).month() - 1;
+    const int month = d->first + index;
+    return month - 12 * (month < 0 ? (month - 11) / 12 : month / 12);
 }
 
 /*!
@@ -206,7 +240,9 @@ int QQuickCalendarModel::monthAt(int index) const
 int QQuickCalendarModel::yearAt(int index) const
 {
     Q_D(const QQuickCalendarModel);
-    return d->from.addMonths(index).year();
+    const int month = d->first + index;
+    const int year = (month < 0 ? (month - 11) / 12 : month / 12) + 1;
+    return year > 0 ? year : year - 1;
 }
 
 /*!
@@ -217,7 +253,9 @@ int QQuickCalendarModel::yearAt(int index) const
 int QQuickCalendarModel::indexOf(const QDate &date) const
 {
     Q_D(const QQuickCalendarModel);
-    return d->getCount(d->from, date) - 1;
+    if (!d->from.isValid() || !date.isValid())
+        return -1;
+    return qMax(-1, d->monthIndex(date) - d->first);
 }
 
 /*!
@@ -35,6 +35,7 @@
 ****************************************************************************/
 
 #include "qquickdayofweekmodel_p.h"
+#include "qquickcalendarcache_p.h"
 
 #include <QtCore/private/qabstractitemmodel_p.h>
 
@@ -45,7 +46,10 @@ class QQuickDayOfWeekModelPrivate : public QAbstractItemModelPrivate
     Q_DECLARE_PUBLIC(QQuickDayOfWeekModel)
 
 public:
+    QQuickDayOfWeekModelPrivate() : names(QQuickCalendarCache::dayNames(locale)) { }
+
     QLocale locale;
+    QQuickCalendarDayNames names;
 };
 
 QQuickDayOfWeekModel::QQuickDayOfWeekModel(QObject *parent) :
@@ -63,9 +67,15 @@ void QQuickDayOfWeekModel::setLocale(const QLocale &locale)
 {
     Q_D(QQuickDayOfWeekModel);
     if (d->locale != locale) {
+        const Qt::DayOfWeek oldFirstDayOfWeek = d->locale.firstDayOfWeek();
         d->locale = locale;
+        d->names = QQuickCalendarCache::dayNames(locale);
         emit localeChanged();
-        emit dataChanged(index(0, 0), index(6, 0));
+        if (oldFirstDayOfWeek != locale.firstDayOfWeek()) {
+            emit dataChanged(index(0, 0), index(6, 0));
+        } else {
+            emit dataChanged(index(0, 0), index(6, 0), QVector<int>() << LongNameRole << ShortNameRole << NarrowNameRole);
+        }
     }
 }
 
@@ -89,11 +99,11 @@ QVariant QQuickDayOfWeekModel::data(const QModelIndex &index, int role) const
         case DayRole:
             return day;
         case LongNameRole:
-            return d->locale.standaloneDayName(day == 0 ? Qt::Sunday : day, QLocale::LongFormat);
+            return d->names.longNames[day == 0 ? Qt::Sunday - 1 : day - 1];
         case ShortNameRole:
-            return d->locale.standaloneDayName(day == 0 ? Qt::Sunday : day, QLocale::ShortFormat);
+            return d->names.shortNames[day == 0 ? Qt::Sunday - 1 : day - 1];
         case NarrowNameRole:
-            return d->locale.standaloneDayName(day == 0 ? Qt::Sunday : day, QLocale::NarrowFormat);
+            return d->names.narrowNames[day == 0 ? Qt::Sunday - 1 : day - 1];
         default:
             break;
         }
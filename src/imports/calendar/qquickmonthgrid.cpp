@@ -102,12 +102,11 @@ class QQuickMonthGridPrivate : public QQuickControlPrivate
     Q_DECLARE_PUBLIC(QQuickMonthGrid)
 
 public:
-    QQuickMonthGridPrivate() : pressTimer(0), pressedItem(nullptr), model(nullptr), delegate(nullptr) { }
+    QQuickMonthGridPrivate() : pressTimer(0), model(nullptr), delegate(nullptr) { }
 
     void resizeItems();
 
-    QQuickItem *cellAt(const QPointF &pos) const;
-    QDate dateOf(QQuickItem *cell) const;
+    int cellAt(const QPointF &pos) const;
 
     void updatePress(const QPointF &pos);
     void clearPress(bool clicked);
@@ -117,13 +116,10 @@ public:
     void handleRelease(const QPointF &point) override;
     void handleUngrab() override;
 
-    static void setContextProperty(QQuickItem *item, const QString &name, const QVariant &value);
-
     QString title;
     QVariant source;
     QDate pressedDate;
     int pressTimer;
-    QQuickItem *pressedItem;
     QQuickMonthModel *model;
     QQmlComponent *delegate;
 };
@@ -144,30 +140,49 @@ void QQuickMonthGridPrivate::resizeItems()
     }
 }
 
-QQuickItem *QQuickMonthGridPrivate::cellAt(const QPointF &pos) const
+// Maps a position to the index of the cell directly from the grid geometry
+// (see resizeItems()), instead of looking up the cell item and its index.
+int QQuickMonthGridPrivate::cellAt(const QPointF &pos) const
 {
     Q_Q(const QQuickMonthGrid);
-    if (contentItem) {
-        QPointF mapped = q->mapToItem(contentItem, pos);
-        return contentItem->childAt(mapped.x(), mapped.y());
-    }
-    return nullptr;
-}
+    if (!contentItem)
+        return -1;
 
-QDate QQuickMonthGridPrivate::dateOf(QQuickItem *cell) const
-{
-    if (contentItem)
-        return model->dateAt(contentItem->childItems().indexOf(cell));
-    return QDate();
+    const qreal cellWidth = (contentItem->width() - 6 * spacing) / 7;
+    const qreal cellHeight = (contentItem->height() - 5 * spacing) / 6;
+    if (cellWidth <= 0 || cellHeight <= 0)
+        return -1;
+
+    const QPointF mapped = q->mapToItem(contentItem, pos);
+    if (mapped.x() < 0 || mapped.y() < 0)
+        return -1;
+
+    int column = mapped.x() / (cellWidth + spacing);
+    const int row = mapped.y() / (cellHeight + spacing);
+    if (column > 6 || row > 5)
+        return -1;
+
+    // the spacing between the cells does not belong to any cell
+    if (mapped.x() - column * (cellWidth + spacing) >= cellWidth
+            || mapped.y() - row * (cellHeight + spacing) >= cellHeight)
+        return -1;
+
+    if (QQuickItemPrivate::get(contentItem)->effectiveLayoutMirror)
+        column = 6 - column;
+
+    return row * 7 + column;
 }
 
 void QQuickMonthGridPrivate::updatePress(const QPointF &pos)
 {
     Q_Q(QQuickMonthGrid);
+    const int index = cellAt(pos);
+    if (pressedDate.isValid() && index == model->pressedIndex())
+        return;
+
     clearPress(false);
-    pressedItem = cellAt(pos);
-    setContextProperty(pressedItem, QStringLiteral("pressed"), true);
-    pressedDate = dateOf(pressedItem);
+    model->setPressedIndex(index);
+    pressedDate = model->dateAt(index);
     if (pressedDate.isValid())
         emit q->pressed(pressedDate);
 }
@@ -175,14 +190,13 @@ void QQuickMonthGridPrivate::updatePress(const QPointF &pos)
 void QQuickMonthGridPrivate::clearPress(bool clicked)
 {
     Q_Q(QQuickMonthGrid);
-    setContextProperty(pressedItem, QStringLiteral("pressed"), false);
+    model->setPressedIndex(-1);
     if (pressedDate.isValid()) {
         emit q->released(pressedDate);
         if (clicked)
             emit q->clicked(pressedDate);
     }
     pressedDate = QDate();
-    pressedItem = nullptr;
 }
 
 void QQuickMonthGridPrivate::handlePress(const QPointF &point)
@@ -212,16 +226,6 @@ void QQuickMonthGridPrivate::handleUngrab()
     clearPress(false);
 }
 
-void QQuickMonthGridPrivate::setContextProperty(QQuickItem *item, const QString &name, const QVariant &value)
-{
-    QQmlContext *context = qmlContext(item);
-    if (context && context->isValid()) {
-        context = context->parentContext();
-        if (context && context->isValid())
-            context->setContextProperty(name, value);
-    }
-}
-
 QQuickMonthGrid::QQuickMonthGrid(QQuickItem *parent) :
     QQuickControl(*(new QQuickMonthGridPrivate), parent)
 {
@@ -369,6 +373,7 @@ void QQuickMonthGrid::setTitle(const QString &title)
         \row \li \b model.weekNumber : int \li The week number
         \row \li \b model.month : int \li The number of the month
         \row \li \b model.year : int \li The number of the year
+        \row \li \b model.pressed : bool \li Whether the delegate is pressed
     \endtable
 
     The following snippet presents the default implementation of the item
@@ -396,13 +401,6 @@ void QQuickMonthGrid::componentComplete()
 {
     Q_D(QQuickMonthGrid);
     QQuickControl::componentComplete();
-    if (d->contentItem) {
-        const auto childItems = d->contentItem->childItems();
-        for (QQuickItem *child : childItems) {
-            if (!QQuickItemPrivate::get(child)->isTransparentForPositioner())
-                d->setContextProperty(child, QStringLiteral("pressed"), false);
-        }
-    }
     d->resizeItems();
 }
 
@@ -35,6 +35,7 @@
 ****************************************************************************/
 
 #include "qquickmonthmodel_p.h"
+#include "qquickcalendarcache_p.h"
 
 #include <QtCore/private/qabstractitemmodel_p.h>
 
@@ -51,28 +52,83 @@ class QQuickMonthModelPrivate : public QAbstractItemModelPrivate
     Q_DECLARE_PUBLIC(QQuickMonthModel)
 
 public:
-    QQuickMonthModelPrivate() : dates(daysOnACalendarMonth)
+    QQuickMonthModelPrivate() : firstDay(0), leadingDays(0), daysInMonth(0),
+        daysInPreviousMonth(0), previousMonth(0), previousYear(0), nextMonth(0), nextYear(0),
+        pressedIndex(-1)
     {
-        today = QDate::currentDate();
-        month = today.month();
-        year = today.year();
+        for (int i = 0; i < daysOnACalendarMonth; ++i)
+            weekNumbers[i] = 0;
+
+        QDate date = QDate::currentDate();
+        todayJulianDay = date.toJulianDay();
+        month = date.month();
+        year = date.year();
     }
 
-    bool populate(int month, int year, const QLocale &locale, bool force = false);
+    struct Day {
+        int day;
+        int month;
+        int year;
+        bool today;
+    };
+
+    void populate(int month, int year, const QLocale &locale, bool force = false);
+    Day dayAt(int index) const;
 
     int month;
     int year;
     QString title;
     QLocale locale;
-    QVector<QDate> dates;
-    QDate today;
+
+    // The dates are laid out arithmetically from the Julian day of the first
+    // cell instead of being stored. The week numbers are cached per cell,
+    // because a row that does not start on a Monday spans two ISO weeks.
+    qint64 firstDay;
+    qint64 todayJulianDay;
+    int leadingDays;
+    int daysInMonth;
+    int daysInPreviousMonth;
+    int previousMonth;
+    int previousYear;
+    int nextMonth;
+    int nextYear;
+    int weekNumbers[daysOnACalendarMonth];
+    int pressedIndex;
 };
 
-bool QQuickMonthModelPrivate::populate(int m, int y, const QLocale &l, bool force)
+QQuickMonthModelPrivate::Day QQuickMonthModelPrivate::dayAt(int index) const
+{
+    Day d;
+    d.today = firstDay + index == todayJulianDay;
+    if (index < leadingDays) {
+        d.day = daysInPreviousMonth - leadingDays + index + 1;
+        d.month = previousMonth;
+        d.year = previousYear;
+    } else if (index < leadingDays + daysInMonth) {
+        d.day = index - leadingDays + 1;
+        d.month = month;
+        d.year = year;
+    } else {
+        d.day = index - leadingDays - daysInMonth + 1;
+        d.month = nextMonth;
+        d.year = nextYear;
+    }
+    return d;
+}
+
+void QQuickMonthModelPrivate::populate(int m, int y, const QLocale &l, bool force)
 {
     Q_Q(QQuickMonthModel);
     if (!force && m == month && y == year && l.firstDayOfWeek() == locale.firstDayOfWeek())
-        return false;
+        return;
+
+    const qint64 oldFirstDay = firstDay;
+    Day oldDays[daysOnACalendarMonth];
+    for (int i = 0; i < daysOnACalendarMonth; ++i)
+        oldDays[i] = dayAt(i);
+    int oldWeekNumbers[daysOnACalendarMonth];
+    for (int i = 0; i < daysOnACalendarMonth; ++i)
+        oldWeekNumbers[i] = weekNumbers[i];
 
     // The actual first (1st) day of the month.
     QDate firstDayOfMonthDate(y, m, 1);
@@ -81,15 +137,55 @@ bool QQuickMonthModelPrivate::populate(int m, int y, const QLocale &l, bool forc
     // the previous month to be visible.
     if (difference == 0)
         difference += 7;
-    QDate firstDateToDisplay = firstDayOfMonthDate.addDays(-difference);
 
-    today = QDate::currentDate();
-    for (int i = 0; i < daysOnACalendarMonth; ++i)
-        dates[i] = firstDateToDisplay.addDays(i);
+    const QDate previousMonthDate = firstDayOfMonthDate.addMonths(-1);
+    const QDate nextMonthDate = firstDayOfMonthDate.addMonths(1);
+
+    firstDay = firstDayOfMonthDate.toJulianDay() - difference;
+    todayJulianDay = QDate::currentDate().toJulianDay();
+    leadingDays = difference;
+    daysInMonth = firstDayOfMonthDate.daysInMonth();
+    daysInPreviousMonth = previousMonthDate.daysInMonth();
+    month = m;
+    year = y;
+    previousMonth = previousMonthDate.month();
+    previousYear = previousMonthDate.year();
+    nextMonth = nextMonthDate.month();
+    nextYear = nextMonthDate.year();
+    QQuickCalendarCache::weekNumbers(y, m, l.firstDayOfWeek(), weekNumbers);
 
     q->setTitle(l.standaloneMonthName(m) + QStringLiteral(" ") + QString::number(y));
 
-    return true;
+    if (!force) {
+        // Only report the rows and roles whose data has actually changed.
+        QVector<int> roles;
+        int top = daysOnACalendarMonth;
+        int bottom = -1;
+        auto changed = [&](int row, int role) {
+            if (!roles.contains(role))
+                roles += role;
+            top = qMin(top, row);
+            bottom = qMax(bottom, row);
+        };
+        for (int i = 0; i < daysOnACalendarMonth; ++i) {
+            const Day &o = oldDays[i];
+            const Day n = dayAt(i);
+            if (oldFirstDay != firstDay)
+                changed(i, QQuickMonthModel::DateRole);
+            if (o.day != n.day)
+                changed(i, QQuickMonthModel::DayRole);
+            if (o.today != n.today)
+                changed(i, QQuickMonthModel::TodayRole);
+            if (oldWeekNumbers[i] != weekNumbers[i])
+                changed(i, QQuickMonthModel::WeekNumberRole);
+            if (o.month != n.month)
+                changed(i, QQuickMonthModel::MonthRole);
+            if (o.year != n.year)
+                changed(i, QQuickMonthModel::YearRole);
+        }
+        if (!roles.isEmpty())
+            emit q->dataChanged(q->index(top, 0), q->index(bottom, 0), roles);
+    }
 }
 
 QQuickMonthModel::QQuickMonthModel(QObject *parent) :
@@ -109,9 +205,7 @@ void QQuickMonthModel::setMonth(int month)
 {
     Q_D(QQuickMonthModel);
     if (d->month != month) {
-        if (d->populate(month, d->year, d->locale))
-            emit dataChanged(index(0, 0), index(daysOnACalendarMonth - 1, 0));
-        d->month = month;
+        d->populate(month, d->year, d->locale);
         emit monthChanged();
     }
 }
@@ -126,9 +220,7 @@ void QQuickMonthModel::setYear(int year)
 {
     Q_D(QQuickMonthModel);
     if (d->year != year) {
-        if (d->populate(d->month, year, d->locale))
-            emit dataChanged(index(0, 0), index(daysOnACalendarMonth - 1, 0));
-        d->year = year;
+        d->populate(d->month, year, d->locale);
         emit yearChanged();
     }
 }
@@ -143,8 +235,7 @@ void QQuickMonthModel::setLocale(const QLocale &locale)
 {
     Q_D(QQuickMonthModel);
     if (d->locale != locale) {
-        if (d->populate(d->month, d->year, locale))
-            emit dataChanged(index(0, 0), index(daysOnACalendarMonth - 1, 0));
+        d->populate(d->month, d->year, locale);
         d->locale = locale;
         emit localeChanged();
     }
@@ -168,35 +259,65 @@ void QQuickMonthModel::setTitle(const QString &title)
 QDate QQuickMonthModel::dateAt(int index) const
 {
     Q_D(const QQuickMonthModel);
-    return d->dates.value(index);
+    if (index < 0 || index >= daysOnACalendarMonth)
+        return QDate();
+    return QDate::fromJulianDay(d->firstDay + index);
 }
 
 int QQuickMonthModel::indexOf(const QDate &date) const
 {
     Q_D(const QQuickMonthModel);
-    if (date < d->dates.first() || date > d->dates.last())
+    if (!date.isValid())
+        return -1;
+    const qint64 index = date.toJulianDay() - d->firstDay;
+    if (index < 0 || index >= daysOnACalendarMonth)
         return -1;
-    return qMax(qint64(0), d->dates.first().daysTo(date));
+    return index;
+}
+
+int QQuickMonthModel::pressedIndex() const
+{
+    Q_D(const QQuickMonthModel);
+    return d->pressedIndex;
+}
+
+void QQuickMonthModel::setPressedIndex(int row)
+{
+    Q_D(QQuickMonthModel);
+    if (d->pressedIndex == row)
+        return;
+
+    const int oldRow = d->pressedIndex;
+    d->pressedIndex = row;
+
+    // only the two affected cells need to re-evaluate their bindings
+    const QVector<int> roles = QVector<int>() << PressedRole;
+    if (oldRow != -1)
+        emit dataChanged(index(oldRow, 0), index(oldRow, 0), roles);
+    if (row != -1)
+        emit dataChanged(index(row, 0), index(row, 0), roles);
 }
 
 QVariant QQuickMonthModel::data(const QModelIndex &index, int role) const
 {
     Q_D(const QQuickMonthModel);
     if (index.isValid() && index.row() < daysOnACalendarMonth) {
-        const QDate date = d->dates.at(index.row());
+        const int row = index.row();
         switch (role) {
         case DateRole:
-            return date;
+            return QDate::fromJulianDay(d->firstDay + row);
         case DayRole:
-            return date.day();
+            return d->dayAt(row).day;
         case TodayRole:
-            return date == d->today;
+            return d->firstDay + row == d->todayJulianDay;
         case WeekNumberRole:
-            return date.weekNumber();
+            return d->weekNumbers[row];
         case MonthRole:
-            return date.month() - 1;
+            return d->dayAt(row).month - 1;
         case YearRole:
-            return date.year();
+            return d->dayAt(row).year;
+        case PressedRole:
+            return row == d->pressedIndex;
         default:
             break;
         }
@@ -220,6 +341,7 @@ QHash<int, QByteArray> QQuickMonthModel::roleNames() const
     roles[WeekNumberRole] = QByteArrayLiteral("weekNumber");
     roles[MonthRole] = QByteArrayLiteral("month");
     roles[YearRole] = QByteArrayLiteral("year");
+    roles[PressedRole] = QByteArrayLiteral("pressed");
     return roles;
 }
 
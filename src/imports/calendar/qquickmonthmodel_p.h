@@ -84,13 +84,17 @@ public:
     Q_INVOKABLE QDate dateAt(int index) const;
     Q_INVOKABLE int indexOf(const QDate &date) const;
 
+    int pressedIndex() const;
+    void setPressedIndex(int row);
+
     enum {
         DateRole = Qt::UserRole + 1,
         DayRole,
         TodayRole,
         WeekNumberRole,
         MonthRole,
-        YearRole
+        YearRole,
+        PressedRole
     };
 
     QHash<int, QByteArray> roleNames() const override;
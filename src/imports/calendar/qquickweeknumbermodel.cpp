@@ -35,6 +35,7 @@
 ****************************************************************************/
 
 #include "qquickweeknumbermodel_p.h"
+#include "qquickcalendarcache_p.h"
 
 #include <QtCore/private/qabstractitemmodel_p.h>
 #include <QtCore/qdatetime.h>
@@ -48,6 +49,9 @@ class QQuickWeekNumberModelPrivate : public QAbstractItemModelPrivate
 public:
     QQuickWeekNumberModelPrivate() : month(-1), year(-1)
     {
+        for (int i = 0; i < 6; ++i)
+            weekNumbers[i] = -1;
+
         QDate date = QDate::currentDate();
         init(date.month(), date.year(), locale);
         month = date.month();
@@ -69,19 +73,22 @@ void QQuickWeekNumberModelPrivate::init(int m, int y, const QLocale &l)
     if (m == month && y == year && l.firstDayOfWeek() == locale.firstDayOfWeek())
         return;
 
-    // The actual first (1st) day of the month.
-    QDate firstDayOfMonthDate(y, m, 1);
-    int difference = ((firstDayOfMonthDate.dayOfWeek() - l.firstDayOfWeek()) + 7) % 7;
-    // The first day to display should never be the 1st of the month, as we want some days from
-    // the previous month to be visible.
-    if (difference == 0)
-        difference += 7;
-
-    for (int i = 0; i < 6; ++i)
-        weekNumbers[i] = firstDayOfMonthDate.addDays(i * 7 - difference).weekNumber();
+    int numbers[6 * 7];
+    QQuickCalendarCache::weekNumbers(y, m, l.firstDayOfWeek(), numbers);
+
+    int top = 6;
+    int bottom = -1;
+    for (int i = 0; i < 6; ++i) {
+        // a row is labelled with the week of its first day
+        if (weekNumbers[i] != numbers[i * 7]) {
+            weekNumbers[i] = numbers[i * 7];
+            top = qMin(top, i);
+            bottom = qMax(bottom, i);
+        }
+    }
 
-    if (q) // null at construction
-        emit q->dataChanged(q->index(0, 0), q->index(5, 0));
+    if (q && bottom != -1) // null at construction
+        emit q->dataChanged(q->index(top, 0), q->index(bottom, 0), QVector<int>() << QQuickWeekNumberModel::WeekNumberRole);
 }
 
 QQuickWeekNumberModel::QQuickWeekNumberModel(QObject *parent) :
@@ -57,8 +57,8 @@ T.CheckDelegate {
     icon.color: control.palette.text
 
     contentItem: IconLabel {
-        leftPadding: control.mirrored ? control.indicator.width + control.spacing : 0
-        rightPadding: !control.mirrored ? control.indicator.width + control.spacing : 0
+        leftPadding: control.mirrored && control.indicator ? control.indicator.width + control.spacing : 0
+        rightPadding: !control.mirrored && control.indicator ? control.indicator.width + control.spacing : 0
 
         spacing: control.spacing
         mirrored: control.mirrored
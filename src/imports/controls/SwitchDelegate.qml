@@ -87,8 +87,8 @@ T.SwitchDelegate {
     }
 
     contentItem: IconLabel {
-        leftPadding: control.mirrored ? control.indicator.width + control.spacing : 0
-        rightPadding: !control.mirrored ? control.indicator.width + control.spacing : 0
+        leftPadding: control.mirrored && control.indicator ? control.indicator.width + control.spacing : 0
+        rightPadding: !control.mirrored && control.indicator ? control.indicator.width + control.spacing : 0
 
         spacing: control.spacing
         mirrored: control.mirrored
@@ -67,8 +67,8 @@ T.RadioDelegate {
     }
 
     contentItem: IconLabel {
-        leftPadding: !control.mirrored ? 0 : control.indicator.width + control.spacing
-        rightPadding: control.mirrored ? 0 : control.indicator.width + control.spacing
+        leftPadding: !control.mirrored || !control.indicator ? 0 : control.indicator.width + control.spacing
+        rightPadding: control.mirrored || !control.indicator ? 0 : control.indicator.width + control.spacing
 
         spacing: control.spacing
         mirrored: control.mirrored
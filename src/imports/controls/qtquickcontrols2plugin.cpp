@@ -35,6 +35,7 @@
 ****************************************************************************/
 
 #include <QtCore/private/qfileselector_p.h>
+#include <QtCore/qsettings.h>
 #include <QtQuickControls2/qquickstyle.h>
 #include <QtQuickControls2/private/qquickchecklabel_p.h>
 #include <QtQuickControls2/private/qquickcolor_p.h>
@@ -50,6 +51,7 @@
 #if QT_CONFIG(quick_listview) && QT_CONFIG(quick_pathview)
 #include <QtQuickControls2/private/qquicktumblerview_p.h>
 #endif
+#include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
 #include <QtQuickTemplates2/private/qquickoverlay_p.h>
 #include <QtQuickControls2/private/qquickclippedtext_p.h>
 #include <QtQuickControls2/private/qquickitemgroup_p.h>
@@ -102,6 +104,12 @@ void QtQuickControls2Plugin::registerTypes(const char *uri)
     if (!style.isEmpty())
         QFileSelectorPrivate::addStatics(QStringList() << style.toLower());
 
+#if QT_CONFIG(settings)
+    QSharedPointer<QSettings> settings = QQuickStylePrivate::settings(QStringLiteral("Controls"));
+    if (settings)
+        QQuickControlPrivate::setDefaultLazyDelegates(settings->value(QStringLiteral("LazyDelegates")).toBool());
+#endif
+
     QQuickStyleSelector selector;
     selector.setBaseUrl(typeUrl());
 
@@ -68,8 +68,8 @@ T.CheckDelegate {
     }
 
     contentItem: IconLabel {
-        leftPadding: !control.mirrored ? 0 : control.indicator.width + control.spacing
-        rightPadding: control.mirrored ? 0 : control.indicator.width + control.spacing
+        leftPadding: !control.mirrored || !control.indicator ? 0 : control.indicator.width + control.spacing
+        rightPadding: control.mirrored || !control.indicator ? 0 : control.indicator.width + control.spacing
 
         spacing: control.spacing
         mirrored: control.mirrored
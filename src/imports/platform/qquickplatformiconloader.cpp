@@ -37,11 +37,30 @@
 #include "qquickplatformiconloader_p.h"
 
 #include <QtCore/qobject.h>
+#include <QtCore/qcache.h>
+#include <QtCore/qcoreapplication.h>
 #include <QtCore/qmetaobject.h>
 #include <QtQml/qqml.h>
 
 QT_BEGIN_NAMESPACE
 
+// Icons are shared by all menus, menu items and system tray icons, keyed by
+// (iconSource, iconName), so that the same icon is not converted and looked
+// up from the theme over and over again.
+typedef QCache<QPair<QUrl, QString>, QIcon> QQuickPlatformIconCache;
+Q_GLOBAL_STATIC_WITH_ARGS(QQuickPlatformIconCache, globalIconCache, (100))
+
+static QQuickPlatformIconCache *iconCache()
+{
+    static const bool cleanup = [] {
+        // release the pixmaps before the application goes away
+        qAddPostRoutine([] { globalIconCache()->clear(); });
+        return true;
+    }();
+    Q_UNUSED(cleanup);
+    return globalIconCache();
+}
+
 QQuickPlatformIconLoader::QQuickPlatformIconLoader(int slot, QObject *parent)
     : m_parent(parent),
       m_slot(slot),
@@ -57,6 +76,9 @@ bool QQuickPlatformIconLoader::isEnabled() const
 
 void QQuickPlatformIconLoader::setEnabled(bool enabled)
 {
+    if (m_enabled == enabled)
+        return;
+
     m_enabled = enabled;
     if (m_enabled)
         loadIcon();
@@ -64,8 +86,22 @@ void QQuickPlatformIconLoader::setEnabled(bool enabled)
 
 QIcon QQuickPlatformIconLoader::icon() const
 {
+    if (!m_icon.isNull() || isLoading())
+        return m_icon;
+
+    const QPair<QUrl, QString> key(m_iconSource, m_iconName);
+    if (QIcon *cached = iconCache()->object(key)) {
+        m_icon = *cached;
+        return m_icon;
+    }
+
     QIcon fallback = QPixmap::fromImage(image());
-    return QIcon::fromTheme(m_iconName, fallback);
+    m_icon = QIcon::fromTheme(m_iconName, fallback);
+
+    // don't cache failed loads, so that they get retried
+    if (!m_icon.isNull() && (isReady() || m_iconSource.isEmpty()))
+        iconCache()->insert(key, new QIcon(m_icon));
+    return m_icon;
 }
 
 QUrl QQuickPlatformIconLoader::iconSource() const
@@ -75,6 +111,9 @@ QUrl QQuickPlatformIconLoader::iconSource() const
 
 void QQuickPlatformIconLoader::setIconSource(const QUrl& source)
 {
+    if (m_iconSource == source)
+        return;
+
     m_iconSource = source;
     if (m_enabled)
         loadIcon();
@@ -87,6 +126,9 @@ QString QQuickPlatformIconLoader::iconName() const
 
 void QQuickPlatformIconLoader::setIconName(const QString& name)
 {
+    if (m_iconName == name)
+        return;
+
     m_iconName = name;
     if (m_enabled)
         loadIcon();
@@ -94,14 +136,21 @@ void QQuickPlatformIconLoader::setIconName(const QString& name)
 
 void QQuickPlatformIconLoader::loadIcon()
 {
-    if (m_iconSource.isEmpty()) {
-        clear(m_parent);
-    } else {
-        load(qmlEngine(m_parent), m_iconSource);
-        if (m_slot != -1 && isLoading()) {
+    // disconnect a pending load of the previous source, so
+    // that it cannot update the parent once it finishes
+    clear(m_parent);
+    m_icon = QIcon();
+
+    if (QIcon *cached = iconCache()->object(qMakePair(m_iconSource, m_iconName))) {
+        // no need to (re)load the image when the icon has already been produced
+        m_icon = *cached;
+    } else if (!m_iconSource.isEmpty()) {
+        // load asynchronously, so that menus with lots of icons or icons from
+        // remote sources don't block the GUI thread; the parent is notified
+        // and updates its platform handle once the image is ready
+        load(qmlEngine(m_parent), m_iconSource, QQuickPixmap::Asynchronous | QQuickPixmap::Cache);
+        if (isLoading())
             connectFinished(m_parent, m_slot);
-            m_slot = -1;
-        }
     }
 
     if (!isLoading())
@@ -79,7 +79,7 @@ private:
     QObject *m_parent;
     int m_slot;
     bool m_enabled;
-    QIcon m_icon;
+    mutable QIcon m_icon;
     QUrl m_iconSource;
     QString m_iconName;
 };
@@ -267,8 +267,10 @@ QPlatformMenu * QQuickPlatformMenu::create()
             connect(m_handle, &QPlatformMenu::aboutToShow, this, &QQuickPlatformMenu::aboutToShow);
             connect(m_handle, &QPlatformMenu::aboutToHide, this, &QQuickPlatformMenu::aboutToHide);
 
-            for (QQuickPlatformMenuItem *item : qAsConst(m_items))
+            for (QQuickPlatformMenuItem *item : qAsConst(m_items)) {
                 m_handle->insertMenuItem(item->create(), nullptr);
+                item->scheduleSync(QQuickPlatformMenuItem::SyncAll);
+            }
 
             if (m_menuItem) {
                 if (QPlatformMenuItem *handle = m_menuItem->create())
@@ -782,6 +784,10 @@ void QQuickPlatformMenu::open(QQmlV4Function *args)
         targetRect.moveTo(pos);
 #endif
     }
+    // flush any pending item changes before the native menu is shown
+    for (QQuickPlatformMenuItem *item : qAsConst(m_items))
+        item->sync();
+
     m_handle->showPopup(window,
                         QHighDpi::toNativePixels(targetRect, window),
                         menuItem ? menuItem->handle() : nullptr);
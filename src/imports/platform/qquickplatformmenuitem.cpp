@@ -100,6 +100,8 @@ QT_BEGIN_NAMESPACE
 QQuickPlatformMenuItem::QQuickPlatformMenuItem(QObject *parent)
     : QObject(parent),
       m_complete(false),
+      m_syncPending(false),
+      m_dirty(SyncAll),
       m_enabled(true),
       m_visible(true),
       m_separator(false),
@@ -146,6 +148,7 @@ QPlatformMenuItem *QQuickPlatformMenuItem::create()
         if (m_handle) {
             connect(m_handle, &QPlatformMenuItem::activated, this, &QQuickPlatformMenuItem::activate);
             connect(m_handle, &QPlatformMenuItem::hovered, this, &QQuickPlatformMenuItem::hovered);
+            m_dirty = SyncAll;
         }
     }
     return m_handle;
@@ -153,34 +156,66 @@ QPlatformMenuItem *QQuickPlatformMenuItem::create()
 
 void QQuickPlatformMenuItem::sync()
 {
-    if (!m_complete || !create())
+    m_syncPending = false;
+    if (!m_dirty || !m_complete || !create())
         return;
 
-    m_handle->setEnabled(isEnabled());
-    m_handle->setVisible(isVisible());
-    m_handle->setIsSeparator(m_separator);
-    m_handle->setCheckable(m_checkable);
-    m_handle->setChecked(m_checked);
-    m_handle->setRole(m_role);
-    m_handle->setText(m_text);
-    m_handle->setFont(m_font);
-    m_handle->setHasExclusiveGroup(m_group && m_group->isExclusive());
-    if (m_subMenu && m_subMenu->handle())
+    const int dirty = m_dirty;
+    m_dirty = 0;
+
+    if (dirty & SyncEnabled)
+        m_handle->setEnabled(isEnabled());
+    if (dirty & SyncVisible)
+        m_handle->setVisible(isVisible());
+    if (dirty & SyncSeparator)
+        m_handle->setIsSeparator(m_separator);
+    if (dirty & SyncCheckable)
+        m_handle->setCheckable(m_checkable);
+    if (dirty & SyncChecked)
+        m_handle->setChecked(m_checked);
+    if (dirty & SyncRole)
+        m_handle->setRole(m_role);
+    if (dirty & SyncText)
+        m_handle->setText(m_text);
+    if (dirty & SyncFont)
+        m_handle->setFont(m_font);
+    if (dirty & SyncExclusiveGroup)
+        m_handle->setHasExclusiveGroup(m_group && m_group->isExclusive());
+    if (dirty & SyncSubMenu && m_subMenu && m_subMenu->handle())
         m_handle->setMenu(m_subMenu->handle());
+    if (dirty & SyncIcon && m_iconLoader)
+        m_handle->setIcon(m_iconLoader->icon());
 
 #if QT_CONFIG(shortcut)
-    QKeySequence sequence;
-    if (m_shortcut.type() == QVariant::Int)
-        sequence = QKeySequence(static_cast<QKeySequence::StandardKey>(m_shortcut.toInt()));
-    else
-        sequence = QKeySequence::fromString(m_shortcut.toString());
-    m_handle->setShortcut(sequence.toString());
+    if (dirty & SyncShortcut) {
+        QKeySequence sequence;
+        if (m_shortcut.type() == QVariant::Int)
+            sequence = QKeySequence(static_cast<QKeySequence::StandardKey>(m_shortcut.toInt()));
+        else
+            sequence = QKeySequence::fromString(m_shortcut.toString());
+        m_handle->setShortcut(sequence);
+    }
 #endif
 
     if (m_menu && m_menu->handle())
         m_menu->handle()->syncMenuItem(m_handle);
 }
 
+/*
+    Marks the given attributes dirty and schedules a single flush for the
+    next event loop iteration, so that consecutive property changes end up
+    in one syncMenuItem() call.
+*/
+void QQuickPlatformMenuItem::scheduleSync(int flags)
+{
+    m_dirty |= flags;
+    if (!m_complete || m_syncPending)
+        return;
+
+    m_syncPending = true;
+    QMetaObject::invokeMethod(this, &QQuickPlatformMenuItem::sync, Qt::QueuedConnection);
+}
+
 /*!
     \readonly
     \qmlproperty Menu Qt.labs.platform::MenuItem::menu
@@ -199,6 +234,7 @@ void QQuickPlatformMenuItem::setMenu(QQuickPlatformMenu *menu)
         return;
 
     m_menu = menu;
+    m_dirty = SyncAll;
     emit menuChanged();
 }
 
@@ -220,7 +256,7 @@ void QQuickPlatformMenuItem::setSubMenu(QQuickPlatformMenu *menu)
         return;
 
     m_subMenu = menu;
-    sync();
+    scheduleSync(SyncSubMenu);
     emit subMenuChanged();
 }
 
@@ -247,7 +283,7 @@ void QQuickPlatformMenuItem::setGroup(QQuickPlatformMenuItemGroup *group)
         group->addItem(this);
 
     m_group = group;
-    sync();
+    scheduleSync(SyncEnabled | SyncVisible | SyncExclusiveGroup);
     emit groupChanged();
 
     if (isEnabled() != wasEnabled)
@@ -279,7 +315,7 @@ void QQuickPlatformMenuItem::setEnabled(bool enabled)
 
     bool wasEnabled = isEnabled();
     m_enabled = enabled;
-    sync();
+    scheduleSync(SyncEnabled);
     if (isEnabled() != wasEnabled)
         emit enabledChanged();
 }
@@ -301,7 +337,7 @@ void QQuickPlatformMenuItem::setVisible(bool visible)
 
     bool wasVisible = isVisible();
     m_visible = visible;
-    sync();
+    scheduleSync(SyncVisible);
     if (isVisible() != wasVisible)
         emit visibleChanged();
 }
@@ -325,7 +361,7 @@ void QQuickPlatformMenuItem::setSeparator(bool separator)
         return;
 
     m_separator = separator;
-    sync();
+    scheduleSync(SyncSeparator);
     emit separatorChanged();
 }
 
@@ -353,7 +389,7 @@ void QQuickPlatformMenuItem::setCheckable(bool checkable)
         return;
 
     m_checkable = checkable;
-    sync();
+    scheduleSync(SyncCheckable);
     emit checkableChanged();
 }
 
@@ -379,7 +415,7 @@ void QQuickPlatformMenuItem::setChecked(bool checked)
         setCheckable(true);
 
     m_checked = checked;
-    sync();
+    scheduleSync(SyncChecked);
     emit checkedChanged();
 }
 
@@ -417,7 +453,7 @@ void QQuickPlatformMenuItem::setRole(QPlatformMenuItem::MenuRole role)
         return;
 
     m_role = role;
-    sync();
+    scheduleSync(SyncRole);
     emit roleChanged();
 }
 
@@ -437,7 +473,7 @@ void QQuickPlatformMenuItem::setText(const QString &text)
         return;
 
     m_text = text;
-    sync();
+    scheduleSync(SyncText);
     emit textChanged();
 }
 
@@ -533,7 +569,7 @@ void QQuickPlatformMenuItem::setShortcut(const QVariant& shortcut)
         return;
 
     m_shortcut = shortcut;
-    sync();
+    scheduleSync(SyncShortcut);
     emit shortcutChanged();
 }
 
@@ -555,7 +591,7 @@ void QQuickPlatformMenuItem::setFont(const QFont& font)
         return;
 
     m_font = font;
-    sync();
+    scheduleSync(SyncFont);
     emit fontChanged();
 }
 
@@ -604,8 +640,7 @@ void QQuickPlatformMenuItem::updateIcon()
     if (!m_handle || !m_iconLoader)
         return;
 
-    m_handle->setIcon(m_iconLoader->icon());
-    sync();
+    scheduleSync(SyncIcon);
 }
 
 QT_END_NAMESPACE
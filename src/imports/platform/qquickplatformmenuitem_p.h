@@ -165,7 +165,27 @@ private Q_SLOTS:
     void updateIcon();
 
 private:
+    enum SyncFlag {
+        SyncEnabled = 0x001,
+        SyncVisible = 0x002,
+        SyncSeparator = 0x004,
+        SyncCheckable = 0x008,
+        SyncChecked = 0x010,
+        SyncRole = 0x020,
+        SyncText = 0x040,
+        SyncFont = 0x080,
+        SyncExclusiveGroup = 0x100,
+        SyncSubMenu = 0x200,
+        SyncShortcut = 0x400,
+        SyncIcon = 0x800,
+        SyncAll = 0xfff
+    };
+
+    void scheduleSync(int flags);
+
     bool m_complete;
+    bool m_syncPending;
+    int m_dirty;
     bool m_enabled;
     bool m_visible;
     bool m_separator;
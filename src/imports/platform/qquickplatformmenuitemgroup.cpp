@@ -166,7 +166,7 @@ void QQuickPlatformMenuItemGroup::setEnabled(bool enabled)
 
     for (QQuickPlatformMenuItem *item : qAsConst(m_items)) {
         if (item->m_enabled) {
-            item->sync();
+            item->scheduleSync(QQuickPlatformMenuItem::SyncEnabled);
             emit item->enabledChanged();
         }
     }
@@ -195,7 +195,7 @@ void QQuickPlatformMenuItemGroup::setVisible(bool visible)
 
     for (QQuickPlatformMenuItem *item : qAsConst(m_items)) {
         if (item->m_visible) {
-            item->sync();
+            item->scheduleSync(QQuickPlatformMenuItem::SyncVisible);
             emit item->visibleChanged();
         }
     }
@@ -223,7 +223,7 @@ void QQuickPlatformMenuItemGroup::setExclusive(bool exclusive)
     emit exclusiveChanged();
 
     for (QQuickPlatformMenuItem *item : qAsConst(m_items))
-        item->sync();
+        item->scheduleSync(QQuickPlatformMenuItem::SyncExclusiveGroup);
 }
 
 /*!
@@ -326,6 +326,8 @@ void QtQuickTemplates2Plugin::registerTypes(const char *uri)
     qmlRegisterType<QQuickButtonGroup, 4>(uri, 2, 4, "ButtonGroup");
     qmlRegisterType<QQuickCheckBox, 4>(uri, 2, 4, "CheckBox");
     qmlRegisterType<QQuickCheckDelegate, 4>(uri, 2, 4, "CheckDelegate");
+    qmlRegisterType<QQuickControl, 4>(uri, 2, 4, "Control");
+    qmlRegisterType<QQuickMenu, 4>(uri, 2, 4, "Menu");
     qmlRegisterType<QQuickScrollBar, 4>(uri, 2, 4, "ScrollBar");
     qmlRegisterType<QQuickScrollIndicator, 4>(uri, 2, 4, "ScrollIndicator");
     qmlRegisterType<QQuickSpinBox, 4>(uri, 2, 4, "SpinBox");
@@ -125,7 +125,7 @@ void QQuickIconLabelPrivate::updateOrSyncImage()
     if (updateImage()) {
         if (componentComplete) {
             updateImplicitSize();
-            layout();
+            scheduleLayout();
         }
     } else {
         syncImage();
@@ -186,7 +186,7 @@ void QQuickIconLabelPrivate::updateOrSyncLabel()
     if (updateLabel()) {
         if (componentComplete) {
             updateImplicitSize();
-            layout();
+            scheduleLayout();
         }
     } else {
         syncLabel();
@@ -231,11 +231,37 @@ static QRectF alignedRect(bool mirrored, Qt::Alignment alignment, const QSizeF &
     return QRectF(x, y, w, h);
 }
 
+// Changes to the properties and to the implicit size of the icon and the text
+// tend to come in bursts (e.g. while a control is being created), so they only
+// mark the layout dirty, and a single layout is performed when polishing.
+void QQuickIconLabelPrivate::scheduleLayout()
+{
+    Q_Q(QQuickIconLabel);
+    if (!componentComplete)
+        return;
+
+    layoutDirty = true;
+    q->polish();
+}
+
+// a layout that leaves the geometry unchanged does not touch the children
+static void setItemGeometry(QQuickItem *item, const QRectF &rect)
+{
+    QQuickItemPrivate *p = QQuickItemPrivate::get(item);
+    if (p->x == rect.x() && p->y == rect.y() && p->width == rect.width() && p->height == rect.height())
+        return;
+
+    item->setSize(rect.size());
+    item->setPosition(rect.topLeft());
+}
+
 void QQuickIconLabelPrivate::layout()
 {
     if (!componentComplete)
         return;
 
+    layoutDirty = false;
+
     const qreal availableWidth = width - leftPadding - rightPadding;
     const qreal availableHeight = height - topPadding - bottomPadding;
 
@@ -246,8 +272,7 @@ void QQuickIconLabelPrivate::layout()
                                                 QSizeF(qMin(image->implicitWidth(), availableWidth),
                                                        qMin(image->implicitHeight(), availableHeight)),
                                                 QRectF(leftPadding, topPadding, availableWidth, availableHeight));
-            image->setSize(iconRect.size());
-            image->setPosition(iconRect.topLeft());
+            setItemGeometry(image, iconRect);
         }
         break;
     case QQuickIconLabel::TextOnly:
@@ -256,8 +281,7 @@ void QQuickIconLabelPrivate::layout()
                                                 QSizeF(qMin(label->implicitWidth(), availableWidth),
                                                        qMin(label->implicitHeight(), availableHeight)),
                                                 QRectF(leftPadding, topPadding, availableWidth, availableHeight));
-            label->setSize(textRect.size());
-            label->setPosition(textRect.topLeft());
+            setItemGeometry(label, textRect);
         }
         break;
 
@@ -283,13 +307,11 @@ void QQuickIconLabelPrivate::layout()
                                           QRectF(leftPadding, topPadding, availableWidth, availableHeight));
         if (image) {
             QRectF iconRect = alignedRect(mirrored, Qt::AlignHCenter | Qt::AlignTop, iconSize, combinedRect);
-            image->setSize(iconRect.size());
-            image->setPosition(iconRect.topLeft());
+            setItemGeometry(image, iconRect);
         }
         if (label) {
             QRectF textRect = alignedRect(mirrored, Qt::AlignHCenter | Qt::AlignBottom, textSize, combinedRect);
-            label->setSize(textRect.size());
-            label->setPosition(textRect.topLeft());
+            setItemGeometry(label, textRect);
         }
         break;
     }
@@ -317,13 +339,11 @@ void QQuickIconLabelPrivate::layout()
                                                 QRectF(leftPadding, topPadding, availableWidth, availableHeight));
         if (image) {
             const QRectF iconRect = alignedRect(mirrored, Qt::AlignLeft | Qt::AlignVCenter, iconSize, combinedRect);
-            image->setSize(iconRect.size());
-            image->setPosition(iconRect.topLeft());
+            setItemGeometry(image, iconRect);
         }
         if (label) {
             const QRectF textRect = alignedRect(mirrored, Qt::AlignRight | Qt::AlignVCenter, textSize, combinedRect);
-            label->setSize(textRect.size());
-            label->setPosition(textRect.topLeft());
+            setItemGeometry(label, textRect);
         }
         break;
     }
@@ -349,13 +369,13 @@ void QQuickIconLabelPrivate::unwatchChanges(QQuickItem* item)
 void QQuickIconLabelPrivate::itemImplicitWidthChanged(QQuickItem *)
 {
     updateImplicitSize();
-    layout();
+    scheduleLayout();
 }
 
 void QQuickIconLabelPrivate::itemImplicitHeightChanged(QQuickItem *)
 {
     updateImplicitSize();
-    layout();
+    scheduleLayout();
 }
 
 void QQuickIconLabelPrivate::itemDestroyed(QQuickItem *item)
@@ -463,7 +483,7 @@ void QQuickIconLabel::setDisplay(Display display)
     d->updateImage();
     d->updateLabel();
     d->updateImplicitSize();
-    d->layout();
+    d->scheduleLayout();
 }
 
 qreal QQuickIconLabel::spacing() const
@@ -481,7 +501,7 @@ void QQuickIconLabel::setSpacing(qreal spacing)
     d->spacing = spacing;
     if (d->image && d->label) {
         d->updateImplicitSize();
-        d->layout();
+        d->scheduleLayout();
     }
 }
 
@@ -498,7 +518,7 @@ void QQuickIconLabel::setMirrored(bool mirrored)
         return;
 
     d->mirrored = mirrored;
-    d->layout();
+    d->scheduleLayout();
 }
 
 Qt::Alignment QQuickIconLabel::alignment() const
@@ -525,7 +545,7 @@ void QQuickIconLabel::setAlignment(Qt::Alignment alignment)
         d->image->setVerticalAlignment(static_cast<QQuickImage::VAlignment>(valign));
         d->image->setHorizontalAlignment(static_cast<QQuickImage::HAlignment>(halign));
     }
-    d->layout();
+    d->scheduleLayout();
 }
 
 qreal QQuickIconLabel::topPadding() const
@@ -542,7 +562,7 @@ void QQuickIconLabel::setTopPadding(qreal padding)
 
     d->topPadding = padding;
     d->updateImplicitSize();
-    d->layout();
+    d->scheduleLayout();
 }
 
 void QQuickIconLabel::resetTopPadding()
@@ -564,7 +584,7 @@ void QQuickIconLabel::setLeftPadding(qreal padding)
 
     d->leftPadding = padding;
     d->updateImplicitSize();
-    d->layout();
+    d->scheduleLayout();
 }
 
 void QQuickIconLabel::resetLeftPadding()
@@ -586,7 +606,7 @@ void QQuickIconLabel::setRightPadding(qreal padding)
 
     d->rightPadding = padding;
     d->updateImplicitSize();
-    d->layout();
+    d->scheduleLayout();
 }
 
 void QQuickIconLabel::resetRightPadding()
@@ -608,7 +628,7 @@ void QQuickIconLabel::setBottomPadding(qreal padding)
 
     d->bottomPadding = padding;
     d->updateImplicitSize();
-    d->layout();
+    d->scheduleLayout();
 }
 
 void QQuickIconLabel::resetBottomPadding()
@@ -634,4 +654,12 @@ void QQuickIconLabel::geometryChanged(const QRectF &newGeometry, const QRectF &o
     d->layout();
 }
 
+void QQuickIconLabel::updatePolish()
+{
+    Q_D(QQuickIconLabel);
+    QQuickItem::updatePolish();
+    if (d->layoutDirty)
+        d->layout();
+}
+
 QT_END_NAMESPACE
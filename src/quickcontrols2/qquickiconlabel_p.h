@@ -127,6 +127,7 @@ public:
 protected:
     void componentComplete() override;
     void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void updatePolish() override;
 
 private:
     Q_DISABLE_COPY(QQuickIconLabel)
@@ -78,6 +78,7 @@ public:
     void updateOrSyncLabel();
 
     void updateImplicitSize();
+    void scheduleLayout();
     void layout();
 
     void watchChanges(QQuickItem *item);
@@ -104,6 +105,7 @@ public:
     QQuickIcon icon;
     QQuickIconImage *image = nullptr;
     QQuickMnemonicLabel *label = nullptr;
+    bool layoutDirty = false;
 };
 
 QT_END_NAMESPACE
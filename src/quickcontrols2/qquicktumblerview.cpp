@@ -36,6 +36,7 @@
 
 #include "qquicktumblerview_p.h"
 
+#include <QtCore/qmath.h>
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qquicklistview_p.h>
 #include <QtQuick/private/qquickpathview_p.h>
@@ -45,6 +46,12 @@
 
 QT_BEGIN_NAMESPACE
 
+// The number of delegates kept alive outside of the visible area, on each side.
+// The views only create the delegates that fit in their visible area
+// (pathItemCount for PathView, the view's height for ListView); these are kept
+// in addition to that, so that delegates that just scrolled out can be reused.
+static const int TumblerCacheItemCount = 1;
+
 QQuickTumblerView::QQuickTumblerView(QQuickItem *parent) :
     QQuickItem(parent)
 {
@@ -144,6 +151,7 @@ void QQuickTumblerView::createView()
             m_pathView->setPreferredHighlightBegin(0.5);
             m_pathView->setPreferredHighlightEnd(0.5);
             m_pathView->setHighlightMoveDuration(1000);
+            m_pathView->setCacheItemCount(TumblerCacheItemCount * 2);
             m_pathView->setClip(true);
 
             // Give the view a size.
@@ -203,8 +211,12 @@ void QQuickTumblerView::updateView()
         m_pathView->setPathItemCount(m_tumbler->visibleItemCount() + 1);
         m_pathView->setDragMargin(width() / 2);
     } else {
-        m_listView->setPreferredHighlightBegin(height() / 2 - (height() / m_tumbler->visibleItemCount() / 2));
-        m_listView->setPreferredHighlightEnd(height() / 2 + (height() / m_tumbler->visibleItemCount() / 2));
+        const qreal delegateHeight = height() / m_tumbler->visibleItemCount();
+        m_listView->setPreferredHighlightBegin(height() / 2 - (delegateHeight / 2));
+        m_listView->setPreferredHighlightEnd(height() / 2 + (delegateHeight / 2));
+        // The default cache buffer is specified in pixels and can hold many
+        // small tumbler delegates; only keep a fixed number of them around.
+        m_listView->setCacheBuffer(qCeil(delegateHeight * TumblerCacheItemCount));
     }
 }
 
@@ -337,12 +337,16 @@ void QQuickAbstractButtonPrivate::toggle(bool value)
         emit q->toggled();
 }
 
-static inline QString indicatorName() { return QStringLiteral("indicator"); }
+static inline int indicatorIndex()
+{
+    static const int index = QQuickAbstractButton::staticMetaObject.indexOfProperty("indicator");
+    return index;
+}
 
 void QQuickAbstractButtonPrivate::cancelIndicator()
 {
     Q_Q(QQuickAbstractButton);
-    quickCancelDeferred(q, indicatorName());
+    quickCancelDeferred(q, indicatorIndex());
 }
 
 void QQuickAbstractButtonPrivate::executeIndicator(bool complete)
@@ -352,9 +356,18 @@ void QQuickAbstractButtonPrivate::executeIndicator(bool complete)
         return;
 
     if (!indicator || complete)
-        quickBeginDeferred(q, indicatorName(), indicator);
+        quickBeginDeferred(q, indicatorIndex(), indicator);
     if (complete)
-        quickCompleteDeferred(q, indicatorName(), indicator);
+        quickCompleteDeferred(q, indicator);
+}
+
+void QQuickAbstractButtonPrivate::executeDelegates(bool notify)
+{
+    Q_Q(QQuickAbstractButton);
+    executeIndicator(true);
+    if (notify && indicator)
+        emit q->indicatorChanged();
+    QQuickControlPrivate::executeDelegates(notify);
 }
 
 QQuickAbstractButton *QQuickAbstractButtonPrivate::findCheckedButton() const
@@ -661,8 +674,8 @@ void QQuickAbstractButton::setAutoRepeat(bool repeat)
 QQuickItem *QQuickAbstractButton::indicator() const
 {
     QQuickAbstractButtonPrivate *d = const_cast<QQuickAbstractButtonPrivate *>(d_func());
-    if (!d->indicator)
-        d->executeIndicator();
+    if (!d->indicator && !d->deferDelegates())
+        d->executeIndicator(d->componentComplete);
     return d->indicator;
 }
 
@@ -919,13 +932,6 @@ void QQuickAbstractButton::toggle()
     setChecked(!d->checked);
 }
 
-void QQuickAbstractButton::componentComplete()
-{
-    Q_D(QQuickAbstractButton);
-    d->executeIndicator(true);
-    QQuickControl::componentComplete();
-}
-
 bool QQuickAbstractButton::event(QEvent *event)
 {
     Q_D(QQuickAbstractButton);
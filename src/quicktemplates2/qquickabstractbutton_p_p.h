@@ -103,6 +103,8 @@ public:
     void cancelIndicator();
     void executeIndicator(bool complete = false);
 
+    void executeDelegates(bool notify = false) override;
+
     // copied from qabstractbutton.cpp
     static const int AUTO_REPEAT_DELAY = 300;
     static const int AUTO_REPEAT_INTERVAL = 100;
@@ -38,6 +38,7 @@
 
 #include <QtCore/private/qobject_p.h>
 #include <QtCore/qmetaobject.h>
+#include <QtCore/qset.h>
 #include <QtCore/qvariant.h>
 #include <QtQml/qqmlinfo.h>
 
@@ -157,6 +158,7 @@ public:
     bool exclusive = true;
     QPointer<QQuickAction> checkedAction;
     QVector<QQuickAction*> actions;
+    QSet<QQuickAction*> actionSet;
 };
 
 void QQuickActionGroupPrivate::clear()
@@ -167,6 +169,7 @@ void QQuickActionGroupPrivate::clear()
         QObjectPrivate::disconnect(action, &QQuickAction::checkedChanged, this, &QQuickActionGroupPrivate::_q_updateCurrent);
     }
     actions.clear();
+    actionSet.clear();
 }
 
 void QQuickActionGroupPrivate::actionTriggered()
@@ -185,7 +188,7 @@ void QQuickActionGroupPrivate::_q_updateCurrent()
     QQuickAction *action = qobject_cast<QQuickAction*>(q->sender());
     if (action && action->isChecked())
         q->setCheckedAction(action);
-    else if (!actions.contains(checkedAction))
+    else if (!actionSet.contains(checkedAction))
         q->setCheckedAction(nullptr);
 }
 
@@ -363,7 +366,7 @@ void QQuickActionGroup::setEnabled(bool enabled)
 void QQuickActionGroup::addAction(QQuickAction *action)
 {
     Q_D(QQuickActionGroup);
-    if (!action || d->actions.contains(action))
+    if (!action || d->actionSet.contains(action))
         return;
 
     const bool enabledChange = d->changeEnabled(action, d->enabled);
@@ -378,6 +381,7 @@ void QQuickActionGroup::addAction(QQuickAction *action)
         emit action->enabledChanged(action->isEnabled());
 
     d->actions.append(action);
+    d->actionSet.insert(action);
     emit actionsChanged();
 }
 
@@ -395,7 +399,7 @@ void QQuickActionGroup::addAction(QQuickAction *action)
 void QQuickActionGroup::removeAction(QQuickAction *action)
 {
     Q_D(QQuickActionGroup);
-    if (!action || !d->actions.contains(action))
+    if (!action || !d->actionSet.contains(action))
         return;
 
     const bool enabledChange = d->changeEnabled(action, d->enabled);
@@ -410,6 +414,7 @@ void QQuickActionGroup::removeAction(QQuickAction *action)
         emit action->enabledChanged(action->isEnabled());
 
     d->actions.removeOne(action);
+    d->actionSet.remove(action);
     emit actionsChanged();
 }
 
@@ -46,12 +46,15 @@
 #include "qquickdeferredexecute_p_p.h"
 #include "qquickdeferredpointer_p_p.h"
 
+#include <QtCore/qloggingcategory.h>
 #include <QtCore/private/qobject_p.h>
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qquickitemchangelistener_p.h>
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(lcApplicationWindowLayout, "qt.quick.controls.applicationwindow.layout")
+
 /*!
     \qmltype ApplicationWindow
     \inherits Window
@@ -129,6 +132,7 @@ public:
     }
 
     void relayout();
+    void scheduleRelayout();
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
     void itemVisibilityChanged(QQuickItem *item) override;
@@ -160,6 +164,7 @@ public:
     void executeBackground(bool complete = false);
 
     bool complete = true;
+    bool relayoutPending = false;
     QQuickDeferredPointer<QQuickItem> background;
     QQuickItem *contentItem = nullptr;
     QQuickItem *menuBar = nullptr;
@@ -173,6 +178,26 @@ public:
     QQuickApplicationWindow *q_ptr = nullptr;
 };
 
+class QQuickApplicationWindowContentItem : public QQuickItem
+{
+public:
+    QQuickApplicationWindowContentItem(QQuickApplicationWindowPrivate *windowPrivate, QQuickItem *parent)
+        : QQuickItem(parent), windowPrivate(windowPrivate)
+    {
+    }
+
+protected:
+    void updatePolish() override
+    {
+        QQuickItem::updatePolish();
+        if (windowPrivate->relayoutPending)
+            windowPrivate->relayout();
+    }
+
+private:
+    QQuickApplicationWindowPrivate *windowPrivate;
+};
+
 static void layoutItem(QQuickItem *item, qreal y, qreal width)
 {
     if (!item)
@@ -189,9 +214,12 @@ static void layoutItem(QQuickItem *item, qreal y, qreal width)
 void QQuickApplicationWindowPrivate::relayout()
 {
     Q_Q(QQuickApplicationWindow);
+    relayoutPending = false;
     if (!complete)
         return;
 
+    qCDebug(lcApplicationWindowLayout) << q << "->" << q->size();
+
     QQuickItem *content = q->contentItem();
     qreal hh = header && header->isVisible() ? header->height() : 0;
     qreal fh = footer && footer->isVisible() ? footer->height() : 0;
@@ -218,30 +246,43 @@ void QQuickApplicationWindowPrivate::relayout()
     }
 }
 
+void QQuickApplicationWindowPrivate::scheduleRelayout()
+{
+    Q_Q(QQuickApplicationWindow);
+    if (!complete)
+        return;
+
+    // Geometry, visibility and implicit size changes of the menu bar, header
+    // and footer, as well as window resizes, may arrive several times per
+    // frame. Lay out once, when the content item gets polished.
+    relayoutPending = true;
+    q->contentItem()->polish();
+}
+
 void QQuickApplicationWindowPrivate::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff)
 {
     Q_UNUSED(item)
     Q_UNUSED(change)
     Q_UNUSED(diff)
-    relayout();
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::itemVisibilityChanged(QQuickItem *item)
 {
     Q_UNUSED(item);
-    relayout();
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::itemImplicitWidthChanged(QQuickItem *item)
 {
     Q_UNUSED(item);
-    relayout();
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::itemImplicitHeightChanged(QQuickItem *item)
 {
     Q_UNUSED(item);
-    relayout();
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::updateFont(const QFont &f)
@@ -323,12 +364,16 @@ void QQuickApplicationWindowPrivate::contentData_append(QQmlListProperty<QObject
         QQuickPopupPrivate::get(popup)->setWindow(static_cast<QQuickApplicationWindow *>(prop->data));
 }
 
-static inline QString backgroundName() { return QStringLiteral("background"); }
+static inline int backgroundIndex()
+{
+    static const int index = QQuickApplicationWindow::staticMetaObject.indexOfProperty("background");
+    return index;
+}
 
 void QQuickApplicationWindowPrivate::cancelBackground()
 {
     Q_Q(QQuickApplicationWindow);
-    quickCancelDeferred(q, backgroundName());
+    quickCancelDeferred(q, backgroundIndex());
 }
 
 void QQuickApplicationWindowPrivate::executeBackground(bool complete)
@@ -338,9 +383,9 @@ void QQuickApplicationWindowPrivate::executeBackground(bool complete)
         return;
 
     if (!background || complete)
-        quickBeginDeferred(q, backgroundName(), background);
+        quickBeginDeferred(q, backgroundIndex(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
 }
 
 QQuickApplicationWindow::QQuickApplicationWindow(QWindow *parent)
@@ -411,7 +456,7 @@ void QQuickApplicationWindow::setBackground(QQuickItem *background)
         if (qFuzzyIsNull(background->z()))
             background->setZ(-1);
         if (isComponentComplete())
-            d->relayout();
+            d->scheduleRelayout();
     }
     if (!d->background.isExecuting())
         emit backgroundChanged();
@@ -469,7 +514,7 @@ void QQuickApplicationWindow::setHeader(QQuickItem *header)
             buttonBox->setPosition(QQuickDialogButtonBox::Header);
     }
     if (isComponentComplete())
-        d->relayout();
+        d->scheduleRelayout();
     emit headerChanged();
 }
 
@@ -524,7 +569,7 @@ void QQuickApplicationWindow::setFooter(QQuickItem *footer)
             buttonBox->setPosition(QQuickDialogButtonBox::Footer);
     }
     if (isComponentComplete())
-        d->relayout();
+        d->scheduleRelayout();
     emit footerChanged();
 }
 
@@ -572,7 +617,7 @@ QQuickItem *QQuickApplicationWindow::contentItem() const
 {
     QQuickApplicationWindowPrivate *d = const_cast<QQuickApplicationWindowPrivate *>(d_func());
     if (!d->contentItem) {
-        d->contentItem = new QQuickItem(QQuickWindow::contentItem());
+        d->contentItem = new QQuickApplicationWindowContentItem(d, QQuickWindow::contentItem());
         d->contentItem->setFlag(QQuickItem::ItemIsFocusScope);
         d->contentItem->setFocus(true);
         d->relayout();
@@ -810,7 +855,7 @@ void QQuickApplicationWindow::setMenuBar(QQuickItem *menuBar)
             menuBar->setZ(2);
     }
     if (isComponentComplete())
-        d->relayout();
+        d->scheduleRelayout();
     emit menuBarChanged();
 }
 
@@ -842,7 +887,7 @@ void QQuickApplicationWindow::resizeEvent(QResizeEvent *event)
 {
     Q_D(QQuickApplicationWindow);
     QQuickWindowQmlImpl::resizeEvent(event);
-    d->relayout();
+    d->scheduleRelayout();
 }
 
 class QQuickApplicationWindowAttachedPrivate : public QObjectPrivate
@@ -850,13 +895,163 @@ class QQuickApplicationWindowAttachedPrivate : public QObjectPrivate
     Q_DECLARE_PUBLIC(QQuickApplicationWindowAttached)
 
 public:
+    ~QQuickApplicationWindowAttachedPrivate();
+
     void windowChange(QQuickWindow *wnd);
-    void activeFocusChange();
+    void setActiveFocusControl(QQuickItem *control);
 
     QQuickWindow *window = nullptr;
     QQuickItem *activeFocusControl = nullptr;
+    int trackerIndex = -1;
+};
+
+// Tracks the active focus control and the building blocks of a window on
+// behalf of all ApplicationWindow attached objects in that window, so that
+// each change is looked up and connected to only once per window instead of
+// once per attached object.
+class QQuickApplicationWindowTracker : public QObject
+{
+public:
+    static QQuickApplicationWindowTracker *get(QQuickWindow *window, bool create = false);
+    ~QQuickApplicationWindowTracker();
+
+    QQuickItem *activeFocusControl() const { return control; }
+
+    void addAttached(QQuickApplicationWindowAttachedPrivate *attached);
+    void removeAttached(QQuickApplicationWindowAttachedPrivate *attached);
+
+private:
+    explicit QQuickApplicationWindowTracker(QQuickWindow *window);
+
+    typedef void (QQuickApplicationWindowAttached::*Signal)();
+    void notifyAttached(Signal signal);
+    void activeFocusChange();
+    void beginNotify();
+    void endNotify();
+
+    QQuickWindow *window = nullptr;
+    QQuickItem *control = nullptr;
+    int notifying = 0;
+    bool compact = false;
+    QVector<QQuickApplicationWindowAttachedPrivate *> attached;
 };
 
+typedef QHash<QQuickWindow *, QQuickApplicationWindowTracker *> QQuickApplicationWindowTrackerHash;
+Q_GLOBAL_STATIC(QQuickApplicationWindowTrackerHash, windowTrackers)
+
+QQuickApplicationWindowTracker::QQuickApplicationWindowTracker(QQuickWindow *window)
+    : QObject(window), window(window)
+{
+    QQuickApplicationWindow *appWindow = qobject_cast<QQuickApplicationWindow *>(window);
+    if (appWindow && QQuickApplicationWindowPrivate::get(appWindow)) {
+        control = appWindow->activeFocusControl();
+        connect(appWindow, &QQuickApplicationWindow::activeFocusControlChanged, this, &QQuickApplicationWindowTracker::activeFocusChange);
+        connect(appWindow, &QQuickApplicationWindow::menuBarChanged, this, [this]() { notifyAttached(&QQuickApplicationWindowAttached::menuBarChanged); });
+        connect(appWindow, &QQuickApplicationWindow::headerChanged, this, [this]() { notifyAttached(&QQuickApplicationWindowAttached::headerChanged); });
+        connect(appWindow, &QQuickApplicationWindow::footerChanged, this, [this]() { notifyAttached(&QQuickApplicationWindowAttached::footerChanged); });
+    } else {
+        control = findActiveFocusControl(window);
+        connect(window, &QQuickWindow::activeFocusItemChanged, this, &QQuickApplicationWindowTracker::activeFocusChange);
+    }
+}
+
+QQuickApplicationWindowTracker::~QQuickApplicationWindowTracker()
+{
+    if (windowTrackers.exists())
+        windowTrackers->remove(window);
+}
+
+QQuickApplicationWindowTracker *QQuickApplicationWindowTracker::get(QQuickWindow *window, bool create)
+{
+    if (!window)
+        return nullptr;
+
+    QQuickApplicationWindowTracker *tracker = windowTrackers->value(window);
+    if (!tracker && create) {
+        tracker = new QQuickApplicationWindowTracker(window);
+        windowTrackers->insert(window, tracker);
+    }
+    return tracker;
+}
+
+void QQuickApplicationWindowTracker::addAttached(QQuickApplicationWindowAttachedPrivate *attachedPrivate)
+{
+    attachedPrivate->trackerIndex = attached.count();
+    attached.append(attachedPrivate);
+}
+
+void QQuickApplicationWindowTracker::removeAttached(QQuickApplicationWindowAttachedPrivate *attachedPrivate)
+{
+    const int index = attachedPrivate->trackerIndex;
+    if (index == -1 || attached.value(index) != attachedPrivate)
+        return;
+
+    attachedPrivate->trackerIndex = -1;
+    if (notifying) {
+        // leave a hole so that the notification loop does not skip anyone
+        attached[index] = nullptr;
+        compact = true;
+        return;
+    }
+
+    QQuickApplicationWindowAttachedPrivate *last = attached.takeLast();
+    if (last != attachedPrivate) {
+        attached[index] = last;
+        last->trackerIndex = index;
+    }
+}
+
+void QQuickApplicationWindowTracker::beginNotify()
+{
+    ++notifying;
+}
+
+void QQuickApplicationWindowTracker::endNotify()
+{
+    if (--notifying > 0 || !compact)
+        return;
+
+    compact = false;
+    attached.removeAll(nullptr);
+    for (int i = 0; i < attached.count(); ++i)
+        attached.at(i)->trackerIndex = i;
+}
+
+void QQuickApplicationWindowTracker::notifyAttached(Signal signal)
+{
+    beginNotify();
+    for (int i = 0; i < attached.count(); ++i) {
+        if (QQuickApplicationWindowAttachedPrivate *attachedPrivate = attached.at(i))
+            emit (static_cast<QQuickApplicationWindowAttached *>(attachedPrivate->q_ptr)->*signal)();
+    }
+    endNotify();
+}
+
+void QQuickApplicationWindowTracker::activeFocusChange()
+{
+    QQuickItem *focusControl = nullptr;
+    if (QQuickApplicationWindow *appWindow = qobject_cast<QQuickApplicationWindow *>(window))
+        focusControl = appWindow->activeFocusControl();
+    else
+        focusControl = findActiveFocusControl(window);
+    if (control == focusControl)
+        return;
+
+    control = focusControl;
+    beginNotify();
+    for (int i = 0; i < attached.count(); ++i) {
+        if (QQuickApplicationWindowAttachedPrivate *attachedPrivate = attached.at(i))
+            attachedPrivate->setActiveFocusControl(control);
+    }
+    endNotify();
+}
+
+QQuickApplicationWindowAttachedPrivate::~QQuickApplicationWindowAttachedPrivate()
+{
+    if (QQuickApplicationWindowTracker *tracker = QQuickApplicationWindowTracker::get(window))
+        tracker->removeAttached(this);
+}
+
 void QQuickApplicationWindowAttachedPrivate::windowChange(QQuickWindow *wnd)
 {
     Q_Q(QQuickApplicationWindowAttached);
@@ -867,41 +1062,21 @@ void QQuickApplicationWindowAttachedPrivate::windowChange(QQuickWindow *wnd)
     if (oldWindow && !QQuickApplicationWindowPrivate::get(oldWindow))
         oldWindow = nullptr; // being deleted (QTBUG-52731)
 
-    if (oldWindow) {
-        disconnect(oldWindow, &QQuickApplicationWindow::activeFocusControlChanged,
-                   this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
-        QObject::disconnect(oldWindow, &QQuickApplicationWindow::menuBarChanged,
-                            q, &QQuickApplicationWindowAttached::menuBarChanged);
-        QObject::disconnect(oldWindow, &QQuickApplicationWindow::headerChanged,
-                            q, &QQuickApplicationWindowAttached::headerChanged);
-        QObject::disconnect(oldWindow, &QQuickApplicationWindow::footerChanged,
-                            q, &QQuickApplicationWindowAttached::footerChanged);
-    } else if (window) {
-        disconnect(window, &QQuickWindow::activeFocusItemChanged,
-                   this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
-    }
+    if (QQuickApplicationWindowTracker *tracker = QQuickApplicationWindowTracker::get(window))
+        tracker->removeAttached(this);
 
     QQuickApplicationWindow *newWindow = qobject_cast<QQuickApplicationWindow *>(wnd);
-    if (newWindow) {
-        connect(newWindow, &QQuickApplicationWindow::activeFocusControlChanged,
-                this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
-        QObject::connect(newWindow, &QQuickApplicationWindow::menuBarChanged,
-                         q, &QQuickApplicationWindowAttached::menuBarChanged);
-        QObject::connect(newWindow, &QQuickApplicationWindow::headerChanged,
-                         q, &QQuickApplicationWindowAttached::headerChanged);
-        QObject::connect(newWindow, &QQuickApplicationWindow::footerChanged,
-                         q, &QQuickApplicationWindowAttached::footerChanged);
-    } else if (wnd) {
-        connect(wnd, &QQuickWindow::activeFocusItemChanged,
-                this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
-    }
+    QQuickApplicationWindowTracker *newTracker = QQuickApplicationWindowTracker::get(wnd, true);
+    if (newTracker)
+        newTracker->addAttached(this);
 
     window = wnd;
     emit q->windowChanged();
-    emit q->contentItemChanged();
+    if (oldWindow || newWindow)
+        emit q->contentItemChanged();
     emit q->overlayChanged();
 
-    activeFocusChange();
+    setActiveFocusControl(newTracker ? newTracker->activeFocusControl() : nullptr);
     if ((oldWindow && oldWindow->menuBar()) || (newWindow && newWindow->menuBar()))
         emit q->menuBarChanged();
     if ((oldWindow && oldWindow->header()) || (newWindow && newWindow->header()))
@@ -910,14 +1085,9 @@ void QQuickApplicationWindowAttachedPrivate::windowChange(QQuickWindow *wnd)
         emit q->footerChanged();
 }
 
-void QQuickApplicationWindowAttachedPrivate::activeFocusChange()
+void QQuickApplicationWindowAttachedPrivate::setActiveFocusControl(QQuickItem *control)
 {
     Q_Q(QQuickApplicationWindowAttached);
-    QQuickItem *control = nullptr;
-    if (QQuickApplicationWindow *appWindow = qobject_cast<QQuickApplicationWindow *>(window))
-        control = appWindow->activeFocusControl();
-    else if (window)
-        control = findActiveFocusControl(window);
     if (activeFocusControl == control)
         return;
 
@@ -38,6 +38,7 @@
 
 #include <QtCore/private/qobject_p.h>
 #include <QtCore/qmetaobject.h>
+#include <QtCore/qset.h>
 #include <QtCore/qvariant.h>
 #include <QtQml/qqmlinfo.h>
 
@@ -157,6 +158,7 @@ public:
     void clear();
     void buttonClicked();
     void _q_updateCurrent();
+    void updateCheckedButtons(QQuickAbstractButton *button);
     void updateCheckState();
     void setCheckState(Qt::CheckState state);
 
@@ -171,6 +173,10 @@ public:
     Qt::CheckState checkState = Qt::Unchecked;
     QPointer<QQuickAbstractButton> checkedButton;
     QVector<QQuickAbstractButton*> buttons;
+    // Membership and checked buttons are tracked separately from the ordered
+    // list, so that check state changes don't have to iterate all buttons.
+    QSet<QQuickAbstractButton*> buttonSet;
+    QSet<QQuickAbstractButton*> checkedButtons;
 };
 
 void QQuickButtonGroupPrivate::clear()
@@ -181,6 +187,8 @@ void QQuickButtonGroupPrivate::clear()
         QObjectPrivate::disconnect(button, &QQuickAbstractButton::checkedChanged, this, &QQuickButtonGroupPrivate::_q_updateCurrent);
     }
     buttons.clear();
+    buttonSet.clear();
+    checkedButtons.clear();
 }
 
 void QQuickButtonGroupPrivate::buttonClicked()
@@ -194,28 +202,35 @@ void QQuickButtonGroupPrivate::buttonClicked()
 void QQuickButtonGroupPrivate::_q_updateCurrent()
 {
     Q_Q(QQuickButtonGroup);
+    QQuickAbstractButton *button = qobject_cast<QQuickAbstractButton*>(q->sender());
+    if (button)
+        updateCheckedButtons(button);
+
     if (exclusive) {
-        QQuickAbstractButton *button = qobject_cast<QQuickAbstractButton*>(q->sender());
         if (button && button->isChecked())
             q->setCheckedButton(button);
-        else if (!buttons.contains(checkedButton))
+        else if (!buttonSet.contains(checkedButton))
             q->setCheckedButton(nullptr);
     }
     updateCheckState();
 }
 
+void QQuickButtonGroupPrivate::updateCheckedButtons(QQuickAbstractButton *button)
+{
+    if (button->isChecked() && buttonSet.contains(button))
+        checkedButtons.insert(button);
+    else
+        checkedButtons.remove(button);
+}
+
 void QQuickButtonGroupPrivate::updateCheckState()
 {
     if (!complete || settingCheckState)
         return;
 
-    bool anyChecked = false;
-    bool allChecked = !buttons.isEmpty();
-    for (QQuickAbstractButton *button : qAsConst(buttons)) {
-        const bool isChecked = button->isChecked();
-        anyChecked |= isChecked;
-        allChecked &= isChecked;
-    }
+    const int checkedCount = checkedButtons.count();
+    const bool anyChecked = checkedCount > 0;
+    const bool allChecked = anyChecked && checkedCount == buttons.count();
     setCheckState(Qt::CheckState(anyChecked + allChecked));
 }
 
@@ -405,6 +420,8 @@ void QQuickButtonGroup::setCheckState(Qt::CheckState state)
     if (d->checkState == state || state == Qt::PartiallyChecked)
         return;
 
+    // The combined check state is known up front, so it is not
+    // recalculated for each button that changes along the way.
     d->settingCheckState = true;
     if (d->exclusive) {
         if (d->checkedButton && state == Qt::Unchecked)
@@ -431,7 +448,7 @@ void QQuickButtonGroup::setCheckState(Qt::CheckState state)
 void QQuickButtonGroup::addButton(QQuickAbstractButton *button)
 {
     Q_D(QQuickButtonGroup);
-    if (!button || d->buttons.contains(button))
+    if (!button || d->buttonSet.contains(button))
         return;
 
     QQuickAbstractButtonPrivate::get(button)->group = this;
@@ -442,6 +459,8 @@ void QQuickButtonGroup::addButton(QQuickAbstractButton *button)
         setCheckedButton(button);
 
     d->buttons.append(button);
+    d->buttonSet.insert(button);
+    d->updateCheckedButtons(button);
     d->updateCheckState();
     emit buttonsChanged();
 }
@@ -460,7 +479,7 @@ void QQuickButtonGroup::addButton(QQuickAbstractButton *button)
 void QQuickButtonGroup::removeButton(QQuickAbstractButton *button)
 {
     Q_D(QQuickButtonGroup);
-    if (!button || !d->buttons.contains(button))
+    if (!button || !d->buttonSet.contains(button))
         return;
 
     QQuickAbstractButtonPrivate::get(button)->group = nullptr;
@@ -471,6 +490,8 @@ void QQuickButtonGroup::removeButton(QQuickAbstractButton *button)
         setCheckedButton(nullptr);
 
     d->buttons.removeOne(button);
+    d->buttonSet.remove(button);
+    d->checkedButtons.remove(button);
     d->updateCheckState();
     emit buttonsChanged();
 }
@@ -258,6 +258,8 @@ public:
     void cancelIndicator();
     void executeIndicator(bool complete = false);
 
+    void executeDelegates(bool notify = false) override;
+
     void cancelPopup();
     void executePopup(bool complete = false);
 
@@ -684,12 +686,16 @@ void QQuickComboBoxPrivate::handleUngrab()
     q->setPressed(false);
 }
 
-static inline QString indicatorName() { return QStringLiteral("indicator"); }
+static inline int indicatorIndex()
+{
+    static const int index = QQuickComboBox::staticMetaObject.indexOfProperty("indicator");
+    return index;
+}
 
 void QQuickComboBoxPrivate::cancelIndicator()
 {
     Q_Q(QQuickComboBox);
-    quickCancelDeferred(q, indicatorName());
+    quickCancelDeferred(q, indicatorIndex());
 }
 
 void QQuickComboBoxPrivate::executeIndicator(bool complete)
@@ -699,17 +705,30 @@ void QQuickComboBoxPrivate::executeIndicator(bool complete)
         return;
 
     if (!indicator || complete)
-        quickBeginDeferred(q, indicatorName(), indicator);
+        quickBeginDeferred(q, indicatorIndex(), indicator);
     if (complete)
-        quickCompleteDeferred(q, indicatorName(), indicator);
+        quickCompleteDeferred(q, indicator);
 }
 
-static inline QString popupName() { return QStringLiteral("popup"); }
+void QQuickComboBoxPrivate::executeDelegates(bool notify)
+{
+    Q_Q(QQuickComboBox);
+    executeIndicator(true);
+    if (notify && indicator)
+        emit q->indicatorChanged();
+    QQuickControlPrivate::executeDelegates(notify);
+}
+
+static inline int popupIndex()
+{
+    static const int index = QQuickComboBox::staticMetaObject.indexOfProperty("popup");
+    return index;
+}
 
 void QQuickComboBoxPrivate::cancelPopup()
 {
     Q_Q(QQuickComboBox);
-    quickCancelDeferred(q, popupName());
+    quickCancelDeferred(q, popupIndex());
 }
 
 void QQuickComboBoxPrivate::executePopup(bool complete)
@@ -719,9 +738,9 @@ void QQuickComboBoxPrivate::executePopup(bool complete)
         return;
 
     if (!popup || complete)
-        quickBeginDeferred(q, popupName(), popup);
+        quickBeginDeferred(q, popupIndex(), popup);
     if (complete)
-        quickCompleteDeferred(q, popupName(), popup);
+        quickCompleteDeferred(q, popup);
 }
 
 QQuickComboBox::QQuickComboBox(QQuickItem *parent)
@@ -1033,8 +1052,8 @@ void QQuickComboBox::setDelegate(QQmlComponent* delegate)
 QQuickItem *QQuickComboBox::indicator() const
 {
     QQuickComboBoxPrivate *d = const_cast<QQuickComboBoxPrivate *>(d_func());
-    if (!d->indicator)
-        d->executeIndicator();
+    if (!d->indicator && !d->deferDelegates())
+        d->executeIndicator(d->componentComplete);
     return d->indicator;
 }
 
@@ -1627,7 +1646,6 @@ void QQuickComboBox::wheelEvent(QWheelEvent *event)
 void QQuickComboBox::componentComplete()
 {
     Q_D(QQuickComboBox);
-    d->executeIndicator(true);
     QQuickControl::componentComplete();
     if (d->popup)
         d->executePopup(true);
@@ -39,6 +39,8 @@
 
 #include <QtQuick/private/qquickflickable_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -316,22 +318,117 @@ void QQuickContainerPrivate::removeItem(int index, QQuickItem *item)
     updatingCurrent = false;
 }
 
+/*
+    Returns a mask of the elements in \a sequence that belong to one of
+    its longest increasing subsequences. Those elements are already in
+    the correct relative order and do not need to be moved.
+*/
+static QVector<bool> longestIncreasingSubsequence(const QVector<int> &sequence)
+{
+    const int count = sequence.count();
+    QVector<int> tails; // index in sequence of the smallest tail of each length
+    QVector<int> predecessors(count, -1);
+    tails.reserve(count);
+
+    for (int i = 0; i < count; ++i) {
+        const int value = sequence.at(i);
+        const auto it = std::lower_bound(tails.cbegin(), tails.cend(), value, [&sequence](int index, int v) {
+            return sequence.at(index) < v;
+        });
+        const int length = int(it - tails.cbegin());
+        if (length > 0)
+            predecessors[i] = tails.at(length - 1);
+        if (length == tails.count())
+            tails.append(i);
+        else
+            tails[length] = i;
+    }
+
+    QVector<bool> mask(count, false);
+    for (int i = tails.isEmpty() ? -1 : tails.last(); i != -1; i = predecessors.at(i))
+        mask[i] = true;
+    return mask;
+}
+
 void QQuickContainerPrivate::reorderItems()
 {
     Q_Q(QQuickContainer);
     if (!contentItem)
         return;
 
-    QList<QQuickItem *> siblings = effectiveContentItem(contentItem)->childItems();
+    const int count = contentModel->count();
+    if (count < 2)
+        return;
+
+    QVector<QQuickItem *> items; // the current order of the content model
+    QHash<QQuickItem *, int> indexes;
+    items.reserve(count);
+    indexes.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        QQuickItem *item = itemAt(i);
+        items += item;
+        indexes.insert(item, i);
+    }
 
-    int to = 0;
-    for (int i = 0; i < siblings.count(); ++i) {
-        QQuickItem* sibling = siblings.at(i);
+    // the order of the siblings, expressed as the current indexes in the content model
+    QVector<int> order;
+    QVector<bool> ordered(count, false);
+    order.reserve(count);
+    const QList<QQuickItem *> siblings = effectiveContentItem(contentItem)->childItems();
+    for (QQuickItem *sibling : siblings) {
         if (QQuickItemPrivate::get(sibling)->isTransparentForPositioner())
             continue;
-        int index = contentModel->indexOf(sibling, nullptr);
-        q->moveItem(index, to++);
+        const int index = indexes.value(sibling, -1);
+        if (index != -1 && !ordered.at(index)) {
+            order += index;
+            ordered[index] = true;
+        }
+    }
+    // items that are not among the siblings keep their relative order at the end
+    for (int i = 0; i < count; ++i) {
+        if (!ordered.at(i))
+            order += i;
+    }
+
+    if (std::is_sorted(order.cbegin(), order.cend()))
+        return;
+
+    // Keep the longest run of items that are already in the correct relative
+    // order in place, and move each of the remaining items right after the
+    // item that precedes it in the target order. This results in the minimal
+    // number of moves, instead of moving every single item into place.
+    const QVector<bool> inPlace = longestIncreasingSubsequence(order);
+    QVector<QQuickItem *> reordered = items;
+    QHash<QQuickItem *, int> positions = indexes; // the current indexes in reordered
+    for (int i = 0; i < count; ++i) {
+        if (inPlace.at(i))
+            continue;
+
+        QQuickItem *item = items.at(order.at(i));
+        const int from = positions.value(item);
+        int to = i == 0 ? 0 : positions.value(items.at(order.at(i - 1))) + 1;
+        if (from < to)
+            --to;
+        if (from != to) {
+            reordered.move(from, to);
+            contentModel->move(from, to);
+            // only the items between the old and the new index shift
+            for (int j = qMin(from, to); j <= qMax(from, to); ++j)
+                positions[reordered.at(j)] = j;
+        }
     }
+
+    updatingCurrent = true;
+
+    for (int i = 0; i < count; ++i) {
+        if (reordered.at(i) != items.at(i))
+            q->itemMoved(i, reordered.at(i));
+    }
+
+    if (currentIndex != -1)
+        q->setCurrentIndex(positions.value(items.value(currentIndex)));
+
+    updatingCurrent = false;
 }
 
 void QQuickContainerPrivate::_q_currentIndexChanged()
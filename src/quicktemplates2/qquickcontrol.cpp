@@ -632,12 +632,16 @@ bool QQuickControlPrivate::calcHoverEnabled(const QQuickItem *item)
 }
 #endif
 
-static inline QString contentItemName() { return QStringLiteral("contentItem"); }
+static inline int contentItemIndex()
+{
+    static const int index = QQuickControl::staticMetaObject.indexOfProperty("contentItem");
+    return index;
+}
 
 void QQuickControlPrivate::cancelContentItem()
 {
     Q_Q(QQuickControl);
-    quickCancelDeferred(q, contentItemName());
+    quickCancelDeferred(q, contentItemIndex());
 }
 
 void QQuickControlPrivate::executeContentItem(bool complete)
@@ -647,17 +651,21 @@ void QQuickControlPrivate::executeContentItem(bool complete)
         return;
 
     if (!contentItem || complete)
-        quickBeginDeferred(q, contentItemName(), contentItem);
+        quickBeginDeferred(q, contentItemIndex(), contentItem);
     if (complete)
-        quickCompleteDeferred(q, contentItemName(), contentItem);
+        quickCompleteDeferred(q, contentItem);
 }
 
-static inline QString backgroundName() { return QStringLiteral("background"); }
+static inline int backgroundIndex()
+{
+    static const int index = QQuickControl::staticMetaObject.indexOfProperty("background");
+    return index;
+}
 
 void QQuickControlPrivate::cancelBackground()
 {
     Q_Q(QQuickControl);
-    quickCancelDeferred(q, backgroundName());
+    quickCancelDeferred(q, backgroundIndex());
 }
 
 void QQuickControlPrivate::executeBackground(bool complete)
@@ -667,9 +675,82 @@ void QQuickControlPrivate::executeBackground(bool complete)
         return;
 
     if (!background || complete)
-        quickBeginDeferred(q, backgroundName(), background);
+        quickBeginDeferred(q, backgroundIndex(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
+}
+
+/*
+    Executes the deferred visual delegates that may be created lazily. The
+    content item is not included, because it typically determines the implicit
+    size of the control. Subclasses with additional deferred delegates, such as
+    indicators and handles, reimplement this to execute them as well.
+
+    When the delegates are executed lazily, the bindings that have already read
+    the delegates during creation must be notified about the new delegates.
+*/
+void QQuickControlPrivate::executeDelegates(bool notify)
+{
+    Q_Q(QQuickControl);
+    executeBackground(true);
+    if (notify && background)
+        emit q->backgroundChanged();
+}
+
+void QQuickControlPrivate::materializeDelegates()
+{
+    if (!pendingDelegates)
+        return;
+
+    pendingDelegates = false;
+    executeDelegates(true);
+}
+
+/*
+    Returns \c true if reading a deferred delegate should not execute it yet.
+    Lazy delegates are not executed during creation. After creation, reading
+    a delegate of a hidden control executes it right away, and schedules a
+    polish to materialize the rest of the pending delegates and notify the
+    bindings that read them during creation. Getters must not emit change
+    signals themselves.
+*/
+bool QQuickControlPrivate::deferDelegates() const
+{
+    if (!componentComplete)
+        return hasLazyDelegates();
+
+    if (pendingDelegates)
+        const_cast<QQuickControl *>(q_func())->polish();
+    return false;
+}
+
+static bool qt_default_lazy_delegates = false;
+
+static int qt_lazy_delegates_env()
+{
+    static const int env = []() {
+        bool ok = false;
+        const int value = qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_LAZY_DELEGATES", &ok);
+        return ok ? value : -1;
+    }();
+    return env;
+}
+
+bool QQuickControlPrivate::hasLazyDelegates() const
+{
+    if (explicitLazyDelegates)
+        return lazyDelegates;
+
+    const int env = qt_lazy_delegates_env();
+    if (env != -1)
+        return env != 0;
+
+    return qt_default_lazy_delegates;
+}
+
+void QQuickControlPrivate::setDefaultLazyDelegates(bool lazy)
+{
+    qt_default_lazy_delegates = lazy;
 }
 
 QQuickControl::QQuickControl(QQuickItem *parent)
@@ -691,6 +772,8 @@ void QQuickControl::itemChange(QQuickItem::ItemChange change, const QQuickItem::
         emit paletteChanged();
         break;
     case ItemVisibleHasChanged:
+        if (value.boolValue)
+            d->materializeDelegates();
 #if QT_CONFIG(quicktemplates2_hover)
         if (!value.boolValue)
             setHovered(false);
@@ -718,6 +801,13 @@ void QQuickControl::itemChange(QQuickItem::ItemChange change, const QQuickItem::
     }
 }
 
+void QQuickControl::updatePolish()
+{
+    Q_D(QQuickControl);
+    QQuickItem::updatePolish();
+    d->materializeDelegates();
+}
+
 /*!
     \qmlproperty font QtQuick.Controls::Control::font
 
@@ -1277,8 +1367,8 @@ void QQuickControl::setWheelEnabled(bool enabled)
 QQuickItem *QQuickControl::background() const
 {
     QQuickControlPrivate *d = const_cast<QQuickControlPrivate *>(d_func());
-    if (!d->background)
-        d->executeBackground();
+    if (!d->background && !d->deferDelegates())
+        d->executeBackground(d->componentComplete);
     return d->background;
 }
 
@@ -1415,6 +1505,58 @@ void QQuickControl::resetPalette()
     setPalette(QPalette());
 }
 
+/*!
+    \since QtQuick.Controls 2.4 (Qt 5.11)
+    \qmlproperty bool QtQuick.Controls::Control::lazyDelegates
+
+    This property holds whether the visual delegates of the control, such as
+    the \l background and indicators, are created lazily.
+
+    When enabled, the delegates of a control that is hidden when it is created
+    are not created until the control becomes visible for the first time, or
+    until one of the delegates is accessed. The \l contentItem is always created
+    immediately. This reduces the startup cost of controls on hidden pages.
+
+    The default value is \c false. Lazy delegates can be enabled for all
+    controls in an application by setting the \c QT_QUICK_CONTROLS_LAZY_DELEGATES
+    environment variable, or the \c LazyDelegates entry in the \c Controls
+    section of the \c qtquickcontrols2.conf configuration file.
+
+    \note Bindings that depend on the implicit size of a lazily created delegate
+    are updated when the delegate is created.
+*/
+bool QQuickControl::hasLazyDelegates() const
+{
+    Q_D(const QQuickControl);
+    return d->hasLazyDelegates();
+}
+
+void QQuickControl::setLazyDelegates(bool lazy)
+{
+    Q_D(QQuickControl);
+    const bool wasLazy = d->hasLazyDelegates();
+    d->explicitLazyDelegates = true;
+    d->lazyDelegates = lazy;
+    if (!lazy)
+        d->materializeDelegates();
+    if (lazy != wasLazy)
+        emit lazyDelegatesChanged();
+}
+
+void QQuickControl::resetLazyDelegates()
+{
+    Q_D(QQuickControl);
+    if (!d->explicitLazyDelegates)
+        return;
+
+    const bool wasLazy = d->lazyDelegates;
+    d->explicitLazyDelegates = false;
+    if (!d->hasLazyDelegates())
+        d->materializeDelegates();
+    if (d->hasLazyDelegates() != wasLazy)
+        emit lazyDelegatesChanged();
+}
+
 void QQuickControl::classBegin()
 {
     Q_D(QQuickControl);
@@ -1426,7 +1568,15 @@ void QQuickControl::classBegin()
 void QQuickControl::componentComplete()
 {
     Q_D(QQuickControl);
-    d->executeBackground(true);
+    quickBeginDeferredBatch(this);
+    if (!d->hasLazyDelegates())
+        d->executeDelegates();
+    else if (d->effectiveVisible)
+        d->executeDelegates(true);
+    else
+        d->pendingDelegates = true;
+    quickCompleteDeferredBatch(this);
+    // the content item is created after the background has completed
     d->executeContentItem(true);
     QQuickItem::componentComplete();
     d->resizeBackground();
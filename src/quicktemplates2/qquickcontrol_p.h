@@ -81,6 +81,8 @@ class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickControl : public QQuickItem
     Q_PROPERTY(QQuickItem *contentItem READ contentItem WRITE setContentItem NOTIFY contentItemChanged FINAL)
     // 2.3 (Qt 5.10)
     Q_PROPERTY(QPalette palette READ palette WRITE setPalette RESET resetPalette NOTIFY paletteChanged FINAL REVISION 3)
+    // 2.4 (Qt 5.11)
+    Q_PROPERTY(bool lazyDelegates READ hasLazyDelegates WRITE setLazyDelegates RESET resetLazyDelegates NOTIFY lazyDelegatesChanged FINAL REVISION 4)
     Q_CLASSINFO("DeferredPropertyNames", "background,contentItem")
 
 public:
@@ -152,6 +154,11 @@ public:
     void setPalette(const QPalette &palette);
     void resetPalette();
 
+    // 2.4 (Qt 5.11)
+    bool hasLazyDelegates() const;
+    void setLazyDelegates(bool lazy);
+    void resetLazyDelegates();
+
 Q_SIGNALS:
     void fontChanged();
     void availableWidthChanged();
@@ -174,6 +181,8 @@ Q_SIGNALS:
     void contentItemChanged();
     // 2.3 (Qt 5.10)
     Q_REVISION(3) void paletteChanged();
+    // 2.4 (Qt 5.11)
+    Q_REVISION(4) void lazyDelegatesChanged();
 
 protected:
     virtual QFont defaultFont() const;
@@ -185,6 +194,7 @@ protected:
     void componentComplete() override;
 
     void itemChange(ItemChange change, const ItemChangeData &value) override;
+    void updatePolish() override;
 
     void focusInEvent(QFocusEvent *event) override;
     void focusOutEvent(QFocusEvent *event) override;
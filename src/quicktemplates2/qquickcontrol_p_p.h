@@ -146,6 +146,13 @@ public:
     virtual void cancelBackground();
     virtual void executeBackground(bool complete = false);
 
+    virtual void executeDelegates(bool notify = false);
+    void materializeDelegates();
+    bool deferDelegates() const;
+
+    bool hasLazyDelegates() const;
+    static void setDefaultLazyDelegates(bool lazy);
+
     struct ExtraData {
         QFont requestedFont;
         QPalette requestedPalette;
@@ -162,6 +169,9 @@ public:
     bool hovered = false;
     bool explicitHoverEnabled = false;
 #endif
+    bool lazyDelegates = false;
+    bool explicitLazyDelegates = false;
+    bool pendingDelegates = false;
     int touchId = -1;
     qreal padding = 0;
     qreal topPadding = 0;
@@ -36,24 +36,67 @@
 
 #include "qquickdeferredexecute_p_p.h"
 
-#include <QtCore/qhash.h>
 #include <QtQml/qqmlengine.h>
+#include <QtQml/qqmlinfo.h>
 #include <QtQml/private/qqmldata_p.h>
 #include <QtQml/private/qqmlcomponent_p.h>
 #include <QtQml/private/qqmlobjectcreator_p.h>
+#include <QtQml/private/qqmlproperty_p.h>
+#include <QtQml/private/qqmlpropertycache_p.h>
+
+#include <QtCore/qvarlengtharray.h>
 
 QT_BEGIN_NAMESPACE
 
 namespace QtQuickPrivate {
 
-typedef QHash<uint, QQmlComponentPrivate::DeferredState *> DeferredStates;
+struct DeferredState : public QQmlComponentPrivate::DeferredState
+{
+};
 
-static inline uint qHash(QObject *object, const QString &propertyName)
+void releaseDeferredState(DeferredState *state)
 {
-    return ::qHash(object) + ::qHash(propertyName);
+    delete state;
 }
 
-Q_GLOBAL_STATIC(DeferredStates, deferredStates)
+// Collects the deferred properties of an object that are executed together,
+// so that the properties from the same compilation unit share an object creator
+// and are completed in one pass.
+struct DeferredBatch
+{
+    struct Entry
+    {
+        QV4::CompiledData::CompilationUnit *compilationUnit;
+        QQmlContextData *parentContext;
+        QQmlComponentPrivate::ConstructionState *state;
+    };
+
+    QQmlComponentPrivate::ConstructionState *constructionState(const QQmlData::DeferredData *deferData) const
+    {
+        for (const Entry &entry : entries) {
+            if (entry.compilationUnit == deferData->compilationUnit.data() && entry.parentContext == deferData->context->parent)
+                return entry.state;
+        }
+        return nullptr;
+    }
+
+    struct Executed
+    {
+        void *delegate;
+        SetExecutedFunction setExecuted;
+    };
+
+    QObject *object = nullptr;
+    DeferredState state;
+    QVarLengthArray<Entry, 2> entries;
+    // The delegates are only marked executed once the whole batch has completed
+    QVarLengthArray<Executed, 4> executed;
+    DeferredBatch *previous = nullptr;
+};
+
+// Deferred properties are executed in the thread of the objects,
+// which is the GUI thread for all the items that use them.
+static DeferredBatch *currentBatch = nullptr;
 
 static void cancelDeferred(QQmlData *ddata, int propertyIndex)
 {
@@ -64,13 +107,11 @@ static void cancelDeferred(QQmlData *ddata, int propertyIndex)
     }
 }
 
-static bool beginDeferred(QQmlEnginePrivate *enginePriv, const QQmlProperty &property, QQmlComponentPrivate::DeferredState *deferredState)
+static bool beginDeferred(QQmlEnginePrivate *enginePriv, QObject *object, int propertyIndex, QQmlComponentPrivate::DeferredState *deferredState, DeferredBatch *batch = nullptr)
 {
-    QObject *object = property.object();
     QQmlData *ddata = QQmlData::get(object);
     Q_ASSERT(!ddata->deferredData.isEmpty());
 
-    int propertyIndex = property.index();
     int wasInProgress = enginePriv->inProgressCreations;
 
     for (auto dit = ddata->deferredData.rbegin(); dit != ddata->deferredData.rend(); ++dit) {
@@ -80,13 +121,27 @@ static bool beginDeferred(QQmlEnginePrivate *enginePriv, const QQmlProperty &pro
         if (range.first == deferData->bindings.end())
             continue;
 
-        QQmlComponentPrivate::ConstructionState *state = new QQmlComponentPrivate::ConstructionState;
-        state->completePending = true;
+        // The property is only looked up once it is known to have deferred bindings,
+        // and directly by its index in the property cache instead of by name.
+        const QQmlPropertyData *propertyData = ddata->propertyCache ? ddata->propertyCache->property(propertyIndex) : nullptr;
+        if (!propertyData)
+            break;
+        const QQmlProperty property = QQmlPropertyPrivate::restore(object, *propertyData, nullptr, nullptr);
+
+        QQmlComponentPrivate::ConstructionState *state = batch ? batch->constructionState(deferData) : nullptr;
+        if (!state) {
+            state = new QQmlComponentPrivate::ConstructionState;
+            state->completePending = true;
 
-        QQmlContextData *creationContext = nullptr;
-        state->creator.reset(new QQmlObjectCreator(deferData->context->parent, deferData->compilationUnit, creationContext));
+            QQmlContextData *creationContext = nullptr;
+            state->creator.reset(new QQmlObjectCreator(deferData->context->parent, deferData->compilationUnit, creationContext));
 
-        enginePriv->inProgressCreations++;
+            enginePriv->inProgressCreations++;
+
+            deferredState->constructionStates += state;
+            if (batch)
+                batch->entries.append({deferData->compilationUnit.data(), deferData->context->parent, state});
+        }
 
         typedef QMultiHash<int, const QV4::CompiledData::Binding *> QV4PropertyBindingHash;
         auto it = std::reverse_iterator<QV4PropertyBindingHash::iterator>(range.second);
@@ -97,8 +152,6 @@ static bool beginDeferred(QQmlEnginePrivate *enginePriv, const QQmlProperty &pro
             ++it;
         }
 
-        deferredState->constructionStates += state;
-
         // Cleanup any remaining deferred bindings for this property, also in inner contexts,
         // to avoid executing them later and overriding the property that was just populated.
         cancelDeferred(ddata, propertyIndex);
@@ -108,34 +161,42 @@ static bool beginDeferred(QQmlEnginePrivate *enginePriv, const QQmlProperty &pro
     return enginePriv->inProgressCreations > wasInProgress;
 }
 
-void beginDeferred(QObject *object, const QString &property)
+DeferredState *beginDeferred(QObject *object, int propertyIndex)
 {
     QQmlData *data = QQmlData::get(object);
-    if (data && !data->deferredData.isEmpty() && !data->wasDeleted(object)) {
-        QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine);
+    if (!data || data->deferredData.isEmpty() || data->wasDeleted(object))
+        return nullptr;
 
-        QQmlComponentPrivate::DeferredState *state = new QQmlComponentPrivate::DeferredState;
-        if (beginDeferred(ep, QQmlProperty(object, property), state))
-            deferredStates()->insert(qHash(object, property), state);
-        else
-            delete state;
+    QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine);
 
-        // Release deferred data for those compilation units that no longer have deferred bindings
+    if (currentBatch && currentBatch->object == object) {
+        // completed by completeDeferredBatch()
+        beginDeferred(ep, object, propertyIndex, &currentBatch->state, currentBatch);
         data->releaseDeferredData();
+        return nullptr;
+    }
+
+    DeferredState *state = new DeferredState;
+    if (!beginDeferred(ep, object, propertyIndex, state)) {
+        delete state;
+        state = nullptr;
     }
+
+    // Release deferred data for those compilation units that no longer have deferred bindings
+    data->releaseDeferredData();
+    return state;
 }
 
-void cancelDeferred(QObject *object, const QString &property)
+void cancelDeferred(QObject *object, int propertyIndex)
 {
     QQmlData *data = QQmlData::get(object);
     if (data)
-        cancelDeferred(data, QQmlProperty(object, property).index());
+        cancelDeferred(data, propertyIndex);
 }
 
-void completeDeferred(QObject *object, const QString &property)
+void completeDeferred(QObject *object, DeferredState *state)
 {
     QQmlData *data = QQmlData::get(object);
-    QQmlComponentPrivate::DeferredState *state = deferredStates()->take(qHash(object, property));
     if (data && state && !data->wasDeleted(object)) {
         QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine);
         QQmlComponentPrivate::completeDeferred(ep, state);
@@ -143,6 +204,55 @@ void completeDeferred(QObject *object, const QString &property)
     delete state;
 }
 
+void beginDeferredBatch(QObject *object)
+{
+    Q_ASSERT(!currentBatch || currentBatch->object != object);
+
+    DeferredBatch *batch = new DeferredBatch;
+    batch->object = object;
+    batch->previous = currentBatch;
+    currentBatch = batch;
+}
+
+void completeDeferredBatch(QObject *object)
+{
+    DeferredBatch *batch = currentBatch;
+    if (!batch || batch->object != object) {
+        qmlWarning(object) << "completeDeferredBatch() does not match the current beginDeferredBatch()";
+        Q_ASSERT(!"unbalanced deferred batch");
+        return;
+    }
+
+    // Completing the batch may create objects that execute batches of their own
+    currentBatch = batch->previous;
+
+    QQmlData *data = QQmlData::get(object);
+    if (data && !data->wasDeleted(object)) {
+        if (!batch->state.constructionStates.isEmpty()) {
+            QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine);
+            QQmlComponentPrivate::completeDeferred(ep, &batch->state);
+        }
+        for (const DeferredBatch::Executed &e : qAsConst(batch->executed))
+            e.setExecuted(e.delegate);
+    }
+    delete batch;
+}
+
+bool completeDeferredInBatch(QObject *object, DeferredState *state, void *delegate, SetExecutedFunction setExecuted)
+{
+    if (!currentBatch || currentBatch->object != object)
+        return false;
+
+    if (state) {
+        // created on demand before the batch began, but completed together with it
+        currentBatch->state.constructionStates += state->constructionStates;
+        state->constructionStates.clear();
+        delete state;
+    }
+    currentBatch->executed.append({delegate, setExecuted});
+    return true;
+}
+
 } // QtQuickPrivate
 
 QT_END_NAMESPACE
@@ -55,39 +55,66 @@
 
 QT_BEGIN_NAMESPACE
 
-class QString;
 class QObject;
 
 namespace QtQuickPrivate {
-    void beginDeferred(QObject *object, const QString &property);
-    void cancelDeferred(QObject *object, const QString &property);
-    void completeDeferred(QObject *object, const QString &property);
+    DeferredState *beginDeferred(QObject *object, int propertyIndex);
+    void cancelDeferred(QObject *object, int propertyIndex);
+    void completeDeferred(QObject *object, DeferredState *state);
+
+    void beginDeferredBatch(QObject *object);
+    void completeDeferredBatch(QObject *object);
+
+    typedef void (*SetExecutedFunction)(void *delegate);
+    bool completeDeferredInBatch(QObject *object, DeferredState *state, void *delegate, SetExecutedFunction setExecuted);
 }
 
 template<typename T>
-void quickBeginDeferred(QObject *object, const QString &property, QQuickDeferredPointer<T> &delegate)
+void quickBeginDeferred(QObject *object, int propertyIndex, QQuickDeferredPointer<T> &delegate)
 {
     if (!QQmlVME::componentCompleteEnabled())
            return;
 
     delegate.setExecuting(true);
-    QtQuickPrivate::beginDeferred(object, property);
+    if (QtQuickPrivate::DeferredState *state = QtQuickPrivate::beginDeferred(object, propertyIndex))
+        delegate.setDeferredState(state);
     delegate.setExecuting(false);
 }
 
-inline void quickCancelDeferred(QObject *object, const QString &property)
+inline void quickCancelDeferred(QObject *object, int propertyIndex)
 {
-    QtQuickPrivate::cancelDeferred(object, property);
+    QtQuickPrivate::cancelDeferred(object, propertyIndex);
 }
 
 template<typename T>
-void quickCompleteDeferred(QObject *object, const QString &property, QQuickDeferredPointer<T> &delegate)
+void quickCompleteDeferred(QObject *object, QQuickDeferredPointer<T> &delegate)
 {
     Q_ASSERT(!delegate.wasExecuted());
-    QtQuickPrivate::completeDeferred(object, property);
+
+    QtQuickPrivate::DeferredState *state = delegate.takeDeferredState();
+
+    // Within a batch, the delegate is completed and marked executed by quickCompleteDeferredBatch(),
+    // which also takes over the state of a delegate that was already created before the batch began
+    auto setExecuted = [](void *d) { static_cast<QQuickDeferredPointer<T> *>(d)->setExecuted(); };
+    if (QtQuickPrivate::completeDeferredInBatch(object, state, &delegate, setExecuted))
+        return;
+
+    QtQuickPrivate::completeDeferred(object, state);
     delegate.setExecuted();
 }
 
+inline void quickBeginDeferredBatch(QObject *object)
+{
+    if (QQmlVME::componentCompleteEnabled())
+        QtQuickPrivate::beginDeferredBatch(object);
+}
+
+inline void quickCompleteDeferredBatch(QObject *object)
+{
+    if (QQmlVME::componentCompleteEnabled())
+        QtQuickPrivate::completeDeferredBatch(object);
+}
+
 QT_END_NAMESPACE
 
 #endif // QQUICKDEFERREDEXECUTE_P_P_H
@@ -49,9 +49,15 @@
 //
 
 #include <QtCore/qglobal.h>
+#include <QtQuickTemplates2/private/qtquicktemplates2global_p.h>
 
 QT_BEGIN_NAMESPACE
 
+namespace QtQuickPrivate {
+    struct DeferredState;
+    Q_QUICKTEMPLATES2_PRIVATE_EXPORT void releaseDeferredState(DeferredState *state);
+}
+
 template<typename T>
 class QQuickDeferredPointer
 {
@@ -59,6 +65,7 @@ public:
     inline QQuickDeferredPointer();
     inline QQuickDeferredPointer(T *);
     inline QQuickDeferredPointer(const QQuickDeferredPointer<T> &o);
+    inline ~QQuickDeferredPointer();
 
     inline bool isNull() const;
 
@@ -68,6 +75,9 @@ public:
     inline bool isExecuting() const;
     inline void setExecuting(bool);
 
+    inline void setDeferredState(QtQuickPrivate::DeferredState *state);
+    inline QtQuickPrivate::DeferredState *takeDeferredState();
+
     inline operator T*() const;
     inline operator bool() const;
 
@@ -80,6 +90,9 @@ public:
 
 private:
     quintptr ptr_value = 0;
+    // The deferred execution that has begun but not yet completed. It is
+    // owned by the pointer and is not copied along with the value.
+    QtQuickPrivate::DeferredState *deferred_state = nullptr;
 
     static const quintptr WasExecutedBit = 0x1;
     static const quintptr IsExecutingBit = 0x2;
@@ -104,6 +117,13 @@ QQuickDeferredPointer<T>::QQuickDeferredPointer(const QQuickDeferredPointer<T> &
 {
 }
 
+template<typename T>
+QQuickDeferredPointer<T>::~QQuickDeferredPointer()
+{
+    if (deferred_state)
+        QtQuickPrivate::releaseDeferredState(deferred_state);
+}
+
 template<typename T>
 bool QQuickDeferredPointer<T>::isNull() const
 {
@@ -137,6 +157,22 @@ void QQuickDeferredPointer<T>::setExecuting(bool b)
         ptr_value &= ~IsExecutingBit;
 }
 
+template<typename T>
+void QQuickDeferredPointer<T>::setDeferredState(QtQuickPrivate::DeferredState *state)
+{
+    if (deferred_state)
+        QtQuickPrivate::releaseDeferredState(deferred_state);
+    deferred_state = state;
+}
+
+template<typename T>
+QtQuickPrivate::DeferredState *QQuickDeferredPointer<T>::takeDeferredState()
+{
+    QtQuickPrivate::DeferredState *state = deferred_state;
+    deferred_state = nullptr;
+    return state;
+}
+
 template<typename T>
 QQuickDeferredPointer<T>::operator T*() const
 {
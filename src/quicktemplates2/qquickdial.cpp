@@ -111,6 +111,8 @@ public:
     void cancelHandle();
     void executeHandle(bool complete = false);
 
+    void executeDelegates(bool notify = false) override;
+
     qreal from = 0;
     qreal to = 1;
     qreal value = 0;
@@ -242,12 +244,16 @@ void QQuickDialPrivate::handleUngrab()
     q->setPressed(false);
 }
 
-static inline QString handleName() { return QStringLiteral("handle"); }
+static inline int handleIndex()
+{
+    static const int index = QQuickDial::staticMetaObject.indexOfProperty("handle");
+    return index;
+}
 
 void QQuickDialPrivate::cancelHandle()
 {
     Q_Q(QQuickDial);
-    quickCancelDeferred(q, handleName());
+    quickCancelDeferred(q, handleIndex());
 }
 
 void QQuickDialPrivate::executeHandle(bool complete)
@@ -257,9 +263,18 @@ void QQuickDialPrivate::executeHandle(bool complete)
         return;
 
     if (!handle || complete)
-        quickBeginDeferred(q, handleName(), handle);
+        quickBeginDeferred(q, handleIndex(), handle);
     if (complete)
-        quickCompleteDeferred(q, handleName(), handle);
+        quickCompleteDeferred(q, handle);
+}
+
+void QQuickDialPrivate::executeDelegates(bool notify)
+{
+    Q_Q(QQuickDial);
+    executeHandle(true);
+    if (notify && handle)
+        emit q->handleChanged();
+    QQuickControlPrivate::executeDelegates(notify);
 }
 
 QQuickDial::QQuickDial(QQuickItem *parent)
@@ -534,8 +549,8 @@ void QQuickDial::setPressed(bool pressed)
 QQuickItem *QQuickDial::handle() const
 {
     QQuickDialPrivate *d = const_cast<QQuickDialPrivate *>(d_func());
-    if (!d->handle)
-        d->executeHandle();
+    if (!d->handle && !d->deferDelegates())
+        d->executeHandle(d->componentComplete);
     return d->handle;
 }
 
@@ -731,7 +746,6 @@ void QQuickDial::mirrorChange()
 void QQuickDial::componentComplete()
 {
     Q_D(QQuickDial);
-    d->executeHandle(true);
     QQuickControl::componentComplete();
     setValue(d->value);
     d->updatePosition();
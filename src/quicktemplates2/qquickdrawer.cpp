@@ -444,6 +444,7 @@ bool QQuickDrawerPrivate::handlePress(QQuickItem *item, const QPointF &point, ul
 bool QQuickDrawerPrivate::handleMove(QQuickItem *item, const QPointF &point, ulong timestamp)
 {
     Q_Q(QQuickDrawer);
+    velocityCalculator.updateMeasuring(point, timestamp);
     if (!QQuickPopupPrivate::handleMove(item, point, timestamp))
         return false;
 
@@ -92,16 +92,22 @@ public:
     void cancelLabel();
     void executeLabel(bool complete = false);
 
+    void executeDelegates(bool notify = false) override;
+
     QString title;
     QQuickDeferredPointer<QQuickItem> label;
 };
 
-static inline QString labelName() { return QStringLiteral("label"); }
+static inline int labelIndex()
+{
+    static const int index = QQuickGroupBox::staticMetaObject.indexOfProperty("label");
+    return index;
+}
 
 void QQuickGroupBoxPrivate::cancelLabel()
 {
     Q_Q(QQuickGroupBox);
-    quickCancelDeferred(q, labelName());
+    quickCancelDeferred(q, labelIndex());
 }
 
 void QQuickGroupBoxPrivate::executeLabel(bool complete)
@@ -111,9 +117,18 @@ void QQuickGroupBoxPrivate::executeLabel(bool complete)
         return;
 
     if (!label || complete)
-        quickBeginDeferred(q, labelName(), label);
+        quickBeginDeferred(q, labelIndex(), label);
     if (complete)
-        quickCompleteDeferred(q, labelName(), label);
+        quickCompleteDeferred(q, label);
+}
+
+void QQuickGroupBoxPrivate::executeDelegates(bool notify)
+{
+    Q_Q(QQuickGroupBox);
+    executeLabel(true);
+    if (notify && label)
+        emit q->labelChanged();
+    QQuickFramePrivate::executeDelegates(notify);
 }
 
 QQuickGroupBox::QQuickGroupBox(QQuickItem *parent)
@@ -156,8 +171,8 @@ void QQuickGroupBox::setTitle(const QString &title)
 QQuickItem *QQuickGroupBox::label() const
 {
     QQuickGroupBoxPrivate *d = const_cast<QQuickGroupBoxPrivate *>(d_func());
-    if (!d->label)
-        d->executeLabel();
+    if (!d->label && !d->deferDelegates())
+        d->executeLabel(d->componentComplete);
     return d->label;
 }
 
@@ -178,13 +193,6 @@ void QQuickGroupBox::setLabel(QQuickItem *label)
         emit labelChanged();
 }
 
-void QQuickGroupBox::componentComplete()
-{
-    Q_D(QQuickGroupBox);
-    d->executeLabel(true);
-    QQuickFrame::componentComplete();
-}
-
 QFont QQuickGroupBox::defaultFont() const
 {
     return QQuickControlPrivate::themeFont(QPlatformTheme::GroupBoxTitleFont);
@@ -75,8 +75,6 @@ Q_SIGNALS:
     void labelChanged();
 
 protected:
-    void componentComplete() override;
-
     QFont defaultFont() const override;
     QPalette defaultPalette() const override;
 
@@ -218,12 +218,16 @@ QAccessible::Role QQuickLabelPrivate::accessibleRole() const
 }
 #endif
 
-static inline QString backgroundName() { return QStringLiteral("background"); }
+static inline int backgroundIndex()
+{
+    static const int index = QQuickLabel::staticMetaObject.indexOfProperty("background");
+    return index;
+}
 
 void QQuickLabelPrivate::cancelBackground()
 {
     Q_Q(QQuickLabel);
-    quickCancelDeferred(q, backgroundName());
+    quickCancelDeferred(q, backgroundIndex());
 }
 
 void QQuickLabelPrivate::executeBackground(bool complete)
@@ -233,9 +237,9 @@ void QQuickLabelPrivate::executeBackground(bool complete)
         return;
 
     if (!background || complete)
-        quickBeginDeferred(q, backgroundName(), background);
+        quickBeginDeferred(q, backgroundIndex(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
 }
 
 QQuickLabel::QQuickLabel(QQuickItem *parent)
@@ -42,6 +42,7 @@
 #include "qquickpopupitem_p_p.h"
 #include "qquickaction_p.h"
 
+#include <QtCore/qscopedvaluerollback.h>
 #include <QtGui/qevent.h>
 #include <QtGui/qcursor.h>
 #include <QtGui/qpa/qplatformintegration.h>
@@ -64,6 +65,9 @@ QT_BEGIN_NAMESPACE
 // copied from qfusionstyle.cpp
 static const int SUBMENU_DELAY = 225;
 
+// the number of items whose lazy delegates are created per idle timer event
+static const int PRELOAD_BATCH_SIZE = 10;
+
 /*!
     \qmltype Menu
     \inherits Popup
@@ -169,6 +173,14 @@ static const int SUBMENU_DELAY = 225;
     Although \l {MenuItem}{MenuItems} are most commonly used with Menu, it can
     contain any type of item.
 
+    When menu items create their visual delegates
+    \l {Control::lazyDelegates}{lazily}, Menu creates them in small batches
+    while the application is idle, so that a large menu does not have to create
+    them all when it is opened for the first time. The delegates of the items in
+    a sub-menu are created when the corresponding menu item in the parent menu
+    is highlighted. The delegates can also be created explicitly by calling
+    \l preload().
+
     \sa {Customizing Menu}, MenuItem, {Menu Controls}, {Popup Controls}
 */
 
@@ -195,6 +207,26 @@ QQuickItem *QQuickMenuPrivate::itemAt(int index) const
     return qobject_cast<QQuickItem *>(contentModel->get(index));
 }
 
+/*
+    Returns the index of \a item in the content model, or \c -1 if the item
+    is not in the menu. Unlike QQmlObjectModel::indexOf(), this does not scan
+    the model, so that hovering and focusing the items of a long menu is cheap.
+    Appending and removing the last item update the index in place, and other
+    changes rebuild it on demand.
+*/
+int QQuickMenuPrivate::indexOfItem(QQuickItem *item) const
+{
+    if (itemIndexesDirty) {
+        const int count = contentModel->count();
+        itemIndexes.clear();
+        itemIndexes.reserve(count);
+        for (int i = 0; i < count; ++i)
+            itemIndexes.insert(contentModel->get(i), i);
+        itemIndexesDirty = false;
+    }
+    return itemIndexes.value(item, -1);
+}
+
 void QQuickMenuPrivate::insertItem(int index, QQuickItem *item)
 {
     contentData.append(item);
@@ -205,6 +237,14 @@ void QQuickMenuPrivate::insertItem(int index, QQuickItem *item)
         resizeItem(item);
     QQuickItemPrivate::get(item)->addItemChangeListener(this, QQuickItemPrivate::Destroyed | QQuickItemPrivate::Parent);
     contentModel->insert(index, item);
+    if (!itemIndexesDirty && index == contentModel->count() - 1)
+        itemIndexes.insert(item, index);
+    else
+        itemIndexesDirty = true;
+
+    QQuickControl *control = qobject_cast<QQuickControl *>(item);
+    if (control && control->hasLazyDelegates() && !popupItem->isVisible())
+        startPreloadTimer();
 
     QQuickMenuItem *menuItem = qobject_cast<QQuickMenuItem *>(item);
     if (menuItem) {
@@ -221,6 +261,7 @@ void QQuickMenuPrivate::insertItem(int index, QQuickItem *item)
 void QQuickMenuPrivate::moveItem(int from, int to)
 {
     contentModel->move(from, to);
+    itemIndexesDirty = true;
 }
 
 void QQuickMenuPrivate::removeItem(int index, QQuickItem *item)
@@ -230,6 +271,10 @@ void QQuickMenuPrivate::removeItem(int index, QQuickItem *item)
     QQuickItemPrivate::get(item)->removeItemChangeListener(this, QQuickItemPrivate::Destroyed | QQuickItemPrivate::Parent);
     item->setParentItem(nullptr);
     contentModel->remove(index);
+    if (!itemIndexesDirty && index == contentModel->count())
+        itemIndexes.remove(item);
+    else
+        itemIndexesDirty = true;
 
     QQuickMenuItem *menuItem = qobject_cast<QQuickMenuItem *>(item);
     if (menuItem) {
@@ -261,6 +306,14 @@ QQuickItem *QQuickMenuPrivate::beginCreateItem()
 
     QQml_setParent_noEvent(item, q);
 
+    // Parent the item before it is completed, the same way as items declared
+    // in the menu, so that items with lazy delegates can defer them while the
+    // menu is hidden. The caller inserts the item to the content model.
+    if (item && contentItem) {
+        QScopedValueRollback<bool> rollback(creatingItem, true);
+        item->setParentItem(contentItem);
+    }
+
     return item;
 }
 
@@ -314,7 +367,7 @@ void QQuickMenuPrivate::resizeItems()
 void QQuickMenuPrivate::itemChildAdded(QQuickItem *, QQuickItem *child)
 {
     // add dynamically reparented items (eg. by a Repeater)
-    if (!QQuickItemPrivate::get(child)->isTransparentForPositioner() && !contentData.contains(child))
+    if (!creatingItem && !QQuickItemPrivate::get(child)->isTransparentForPositioner() && !contentData.contains(child))
         insertItem(contentModel->count(), child);
 }
 
@@ -322,7 +375,7 @@ void QQuickMenuPrivate::itemParentChanged(QQuickItem *item, QQuickItem *parent)
 {
     // remove dynamically unparented items (eg. by a Repeater)
     if (!parent)
-        removeItem(contentModel->indexOf(item, nullptr), item);
+        removeItem(indexOfItem(item), item);
 }
 
 void QQuickMenuPrivate::itemSiblingOrderChanged(QQuickItem *)
@@ -336,7 +389,7 @@ void QQuickMenuPrivate::itemSiblingOrderChanged(QQuickItem *)
         QQuickItem* sibling = siblings.at(i);
         if (QQuickItemPrivate::get(sibling)->isTransparentForPositioner())
             continue;
-        int index = contentModel->indexOf(sibling, nullptr);
+        int index = indexOfItem(sibling);
         q->moveItem(index, to++);
     }
 }
@@ -344,14 +397,14 @@ void QQuickMenuPrivate::itemSiblingOrderChanged(QQuickItem *)
 void QQuickMenuPrivate::itemDestroyed(QQuickItem *item)
 {
     QQuickPopupPrivate::itemDestroyed(item);
-    int index = contentModel->indexOf(item, nullptr);
+    int index = indexOfItem(item);
     if (index != -1)
         removeItem(index, item);
 }
 
-void QQuickMenuPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
+void QQuickMenuPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange change, const QRectF &)
 {
-    if (complete)
+    if (complete && change.widthChange())
         resizeItems();
 }
 
@@ -425,7 +478,7 @@ void QQuickMenuPrivate::onItemHovered()
 
     QQuickMenuItem *oldCurrentItem = currentItem;
 
-    int index = contentModel->indexOf(button, nullptr);
+    int index = indexOfItem(button);
     if (index != -1) {
         setCurrentIndex(index, Qt::OtherFocusReason);
         if (oldCurrentItem != currentItem) {
@@ -463,9 +516,9 @@ void QQuickMenuPrivate::onItemActiveFocusChanged()
     if (!item->hasActiveFocus())
         return;
 
-    int indexOfItem = contentModel->indexOf(item, nullptr);
+    int index = indexOfItem(item);
     QQuickControl *control = qobject_cast<QQuickControl *>(item);
-    setCurrentIndex(indexOfItem, control ? control->focusReason() : Qt::OtherFocusReason);
+    setCurrentIndex(index, control ? control->focusReason() : Qt::OtherFocusReason);
 }
 
 QQuickMenu *QQuickMenuPrivate::currentSubMenu() const
@@ -548,6 +601,52 @@ void QQuickMenuPrivate::stopHoverTimer()
     hoverTimer = 0;
 }
 
+void QQuickMenuPrivate::startPreloadTimer()
+{
+    Q_Q(QQuickMenu);
+    if (preloadTimer)
+        return;
+
+    preloadTimer = q->startTimer(0);
+}
+
+void QQuickMenuPrivate::stopPreloadTimer()
+{
+    Q_Q(QQuickMenu);
+    if (!preloadTimer)
+        return;
+
+    q->killTimer(preloadTimer);
+    preloadTimer = 0;
+}
+
+/*
+    Creates the pending lazy delegates of up to \a limit items, or of all
+    items if \a limit is negative. Returns \c true if there are no pending
+    delegates left.
+*/
+bool QQuickMenuPrivate::preloadItems(int limit)
+{
+    int preloaded = 0;
+    const int count = contentModel->count();
+    for (int i = 0; i < count; ++i) {
+        QQuickControl *control = qobject_cast<QQuickControl *>(itemAt(i));
+        if (!control)
+            continue;
+
+        QQuickControlPrivate *p = QQuickControlPrivate::get(control);
+        if (!p->pendingDelegates)
+            continue;
+
+        if (limit >= 0 && preloaded == limit)
+            return false;
+
+        p->materializeDelegates();
+        ++preloaded;
+    }
+    return true;
+}
+
 void QQuickMenuPrivate::setCurrentIndex(int index, Qt::FocusReason reason)
 {
     Q_Q(QQuickMenu);
@@ -568,6 +667,11 @@ void QQuickMenuPrivate::setCurrentIndex(int index, Qt::FocusReason reason)
         if (newCurrentItem) {
             newCurrentItem->setHighlighted(true);
             newCurrentItem->forceActiveFocus(reason);
+            if (QQuickMenu *subMenu = newCurrentItem->subMenu()) {
+                QQuickMenuPrivate *p = QQuickMenuPrivate::get(subMenu);
+                p->preloadRequested = true;
+                p->startPreloadTimer();
+            }
         }
         currentItem = newCurrentItem;
     }
@@ -620,7 +724,7 @@ void QQuickMenuPrivate::contentData_append(QQmlListProperty<QObject> *prop, QObj
         if (QQuickItemPrivate::get(item)->isTransparentForPositioner()) {
             QQuickItemPrivate::get(item)->addItemChangeListener(p, QQuickItemPrivate::SiblingOrder);
             item->setParentItem(p->contentItem);
-        } else if (p->contentModel->indexOf(item, nullptr) == -1) {
+        } else if (p->indexOfItem(item) == -1) {
             q->addItem(item);
         }
     } else {
@@ -690,7 +794,7 @@ void QQuickMenu::insertItem(int index, QQuickItem *item)
     if (index < 0 || index > count)
         index = count;
 
-    int oldIndex = d->contentModel->indexOf(item, nullptr);
+    int oldIndex = d->indexOfItem(item);
     if (oldIndex != -1) {
         if (oldIndex < index)
             --index;
@@ -748,7 +852,7 @@ void QQuickMenu::removeItem(QQuickItem *item)
     if (!item)
         return;
 
-    const int index = d->contentModel->indexOf(item, nullptr);
+    const int index = d->indexOfItem(item);
     if (index == -1)
         return;
 
@@ -1207,7 +1311,7 @@ void QQuickMenu::popup(const QPointF &pos, QQuickItem *menuItem)
     setPosition(pos - QPointF(0, offset));
 
     if (menuItem)
-        d->setCurrentIndex(d->contentModel->indexOf(menuItem, nullptr), Qt::PopupFocusReason);
+        d->setCurrentIndex(d->indexOfItem(menuItem), Qt::PopupFocusReason);
     open();
 }
 
@@ -1334,6 +1438,27 @@ void QQuickMenu::dismiss()
     }
 }
 
+/*!
+    \since QtQuick.Controls 2.4 (Qt 5.11)
+    \qmlmethod void QtQuick.Controls::Menu::preload()
+
+    Creates the pending \l {Control::lazyDelegates}{lazy delegates} of the
+    menu items, so that they do not need to be created when the menu is opened.
+
+    Menu creates the lazy delegates of its items automatically while the
+    application is idle. This method can be called to create them immediately,
+    for example before a context menu is about to be shown. The items of
+    sub-menus are not affected.
+
+    \sa popup(), Control::lazyDelegates
+*/
+void QQuickMenu::preload()
+{
+    Q_D(QQuickMenu);
+    d->stopPreloadTimer();
+    d->preloadItems();
+}
+
 void QQuickMenu::componentComplete()
 {
     Q_D(QQuickMenu);
@@ -1346,10 +1471,15 @@ void QQuickMenu::contentItemChange(QQuickItem *newItem, QQuickItem *oldItem)
     Q_D(QQuickMenu);
     QQuickPopup::contentItemChange(newItem, oldItem);
 
-    if (oldItem)
+    if (oldItem) {
         QQuickItemPrivate::get(oldItem)->removeItemChangeListener(d, QQuickItemPrivate::Children);
-    if (newItem)
+        QQuickItemPrivate::get(oldItem)->removeItemChangeListener(d, QQuickItemPrivate::Geometry);
+    }
+    if (newItem) {
         QQuickItemPrivate::get(newItem)->addItemChangeListener(d, QQuickItemPrivate::Children);
+        // the items only follow the width of the content item
+        QQuickItemPrivate::get(newItem)->updateOrAddGeometryChangeListener(d, QQuickGeometryChange::Width);
+    }
 
     d->contentItem = newItem;
 }
@@ -1421,6 +1551,10 @@ void QQuickMenu::timerEvent(QTimerEvent *event)
         if (QQuickMenu *subMenu = d->currentSubMenu())
             subMenu->open();
         d->stopHoverTimer();
+    } else if (event->timerId() == d->preloadTimer) {
+        // the items of sub-menus are preloaded when the parent menu item is highlighted
+        if ((d->parentMenu && !d->preloadRequested) || d->preloadItems(PRELOAD_BATCH_SIZE))
+            d->stopPreloadTimer();
     }
 }
 
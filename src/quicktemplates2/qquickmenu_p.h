@@ -125,6 +125,9 @@ public:
     Q_REVISION(3) Q_INVOKABLE void popup(QQmlV4Function *args);
     Q_REVISION(3) Q_INVOKABLE void dismiss();
 
+    // 2.4 (Qt 5.11)
+    Q_REVISION(4) Q_INVOKABLE void preload();
+
 protected:
     void componentComplete() override;
     void contentItemChange(QQuickItem *newItem, QQuickItem *oldItem) override;
@@ -48,6 +48,7 @@
 // We mean it.
 //
 
+#include <QtCore/qhash.h>
 #include <QtCore/qvector.h>
 #include <QtCore/qpointer.h>
 
@@ -74,6 +75,7 @@ public:
     }
 
     QQuickItem *itemAt(int index) const;
+    int indexOfItem(QQuickItem *item) const;
     void insertItem(int index, QQuickItem *item);
     void moveItem(int from, int to);
     void removeItem(int index, QQuickItem *item);
@@ -111,6 +113,10 @@ public:
     void startHoverTimer();
     void stopHoverTimer();
 
+    void startPreloadTimer();
+    void stopPreloadTimer();
+    bool preloadItems(int limit = -1);
+
     void setCurrentIndex(int index, Qt::FocusReason reason);
     bool activateNextItem();
     bool activatePreviousItem();
@@ -121,7 +127,10 @@ public:
     static void contentData_clear(QQmlListProperty<QObject> *prop);
 
     bool cascade = false;
+    bool creatingItem = false;
+    bool preloadRequested = false;
     int hoverTimer = 0;
+    int preloadTimer = 0;
     int currentIndex = -1;
     qreal overlap = 0;
     QPointer<QQuickMenu> parentMenu;
@@ -129,6 +138,8 @@ public:
     QQuickItem *contentItem = nullptr; // TODO: cleanup
     QVector<QObject *> contentData;
     QQmlObjectModel *contentModel;
+    mutable bool itemIndexesDirty = false;
+    mutable QHash<QObject *, int> itemIndexes;
     QQmlComponent *delegate = nullptr;
     QString title;
 };
@@ -127,12 +127,16 @@ void QQuickMenuItemPrivate::updateEnabled()
     q->setEnabled(subMenu && subMenu->isEnabled());
 }
 
-static inline QString arrowName() { return QStringLiteral("arrow"); }
+static inline int arrowIndex()
+{
+    static const int index = QQuickMenuItem::staticMetaObject.indexOfProperty("arrow");
+    return index;
+}
 
 void QQuickMenuItemPrivate::cancelArrow()
 {
     Q_Q(QQuickAbstractButton);
-    quickCancelDeferred(q, arrowName());
+    quickCancelDeferred(q, arrowIndex());
 }
 
 void QQuickMenuItemPrivate::executeArrow(bool complete)
@@ -142,9 +146,18 @@ void QQuickMenuItemPrivate::executeArrow(bool complete)
         return;
 
     if (!arrow || complete)
-        quickBeginDeferred(q, arrowName(), arrow);
+        quickBeginDeferred(q, arrowIndex(), arrow);
     if (complete)
-        quickCompleteDeferred(q, arrowName(), arrow);
+        quickCompleteDeferred(q, arrow);
+}
+
+void QQuickMenuItemPrivate::executeDelegates(bool notify)
+{
+    Q_Q(QQuickMenuItem);
+    executeArrow(true);
+    if (notify && arrow)
+        emit q->arrowChanged();
+    QQuickAbstractButtonPrivate::executeDelegates(notify);
 }
 
 /*!
@@ -197,8 +210,8 @@ void QQuickMenuItem::setHighlighted(bool highlighted)
 QQuickItem *QQuickMenuItem::arrow() const
 {
     QQuickMenuItemPrivate *d = const_cast<QQuickMenuItemPrivate *>(d_func());
-    if (!d->arrow)
-        d->executeArrow();
+    if (!d->arrow && !d->deferDelegates())
+        d->executeArrow(d->componentComplete);
     return d->arrow;
 }
 
@@ -247,13 +260,6 @@ QQuickMenu *QQuickMenuItem::subMenu() const
     return d->subMenu;
 }
 
-void QQuickMenuItem::componentComplete()
-{
-    Q_D(QQuickMenuItem);
-    d->executeArrow(true);
-    QQuickAbstractButton::componentComplete();
-}
-
 QFont QQuickMenuItem::defaultFont() const
 {
     return QQuickControlPrivate::themeFont(QPlatformTheme::MenuItemFont);
@@ -87,8 +87,6 @@ Q_SIGNALS:
     Q_REVISION(3) void subMenuChanged();
 
 protected:
-    void componentComplete() override;
-
     QFont defaultFont() const override;
     QPalette defaultPalette() const override;
 
@@ -73,6 +73,8 @@ public:
     void cancelArrow();
     void executeArrow(bool complete = false);
 
+    void executeDelegates(bool notify = false) override;
+
     bool highlighted = false;
     QQuickDeferredPointer<QQuickItem> arrow;
     QQuickMenu *menu = nullptr;
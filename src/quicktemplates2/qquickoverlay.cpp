@@ -69,27 +69,39 @@ QT_BEGIN_NAMESPACE
 
 QVector<QQuickPopup *> QQuickOverlayPrivate::stackingOrderPopups() const
 {
+    if (!stackingOrderDirty)
+        return sortedPopups;
+
     const QList<QQuickItem *> children = paintOrderChildItems();
 
-    QVector<QQuickPopup *> popups;
-    popups.reserve(children.count());
+    sortedPopups.clear();
+    sortedPopups.reserve(children.count());
 
     for (auto it = children.crbegin(), end = children.crend(); it != end; ++it) {
         QQuickPopup *popup = qobject_cast<QQuickPopup *>((*it)->parent());
         if (popup)
-            popups += popup;
+            sortedPopups += popup;
     }
 
-    return popups;
+    sortedDrawers = allDrawers;
+    std::sort(sortedDrawers.begin(), sortedDrawers.end(), [](const QQuickDrawer *one, const QQuickDrawer *another) {
+        return one->z() > another->z();
+    });
+
+    stackingOrderDirty = false;
+    return sortedPopups;
 }
 
 QVector<QQuickDrawer *> QQuickOverlayPrivate::stackingOrderDrawers() const
 {
-    QVector<QQuickDrawer *> sorted(allDrawers);
-    std::sort(sorted.begin(), sorted.end(), [](const QQuickDrawer *one, const QQuickDrawer *another) {
-        return one->z() > another->z();
-    });
-    return sorted;
+    if (stackingOrderDirty)
+        stackingOrderPopups();
+    return sortedDrawers;
+}
+
+void QQuickOverlayPrivate::invalidateStackingOrder()
+{
+    stackingOrderDirty = true;
 }
 
 void QQuickOverlayPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
@@ -241,6 +253,8 @@ void QQuickOverlayPrivate::addPopup(QQuickPopup *popup)
         allDrawers += drawer;
         q->setVisible(!allDrawers.isEmpty() || !q->childItems().isEmpty());
     }
+    QObjectPrivate::connect(popup->popupItem(), &QQuickItem::zChanged, this, &QQuickOverlayPrivate::invalidateStackingOrder);
+    invalidateStackingOrder();
 }
 
 void QQuickOverlayPrivate::removePopup(QQuickPopup *popup)
@@ -249,6 +263,8 @@ void QQuickOverlayPrivate::removePopup(QQuickPopup *popup)
     allPopups.removeOne(popup);
     if (allDrawers.removeOne(static_cast<QQuickDrawer *>(popup)))
         q->setVisible(!allDrawers.isEmpty() || !q->childItems().isEmpty());
+    QObjectPrivate::disconnect(popup->popupItem(), &QQuickItem::zChanged, this, &QQuickOverlayPrivate::invalidateStackingOrder);
+    invalidateStackingOrder();
 }
 
 void QQuickOverlayPrivate::setMouseGrabberPopup(QQuickPopup *popup)
@@ -388,8 +404,10 @@ void QQuickOverlay::itemChange(ItemChange change, const ItemChangeData &data)
     Q_D(QQuickOverlay);
     QQuickItem::itemChange(change, data);
 
-    if (change == ItemChildAddedChange || change == ItemChildRemovedChange)
+    if (change == ItemChildAddedChange || change == ItemChildRemovedChange) {
+        d->invalidateStackingOrder();
         setVisible(!d->allDrawers.isEmpty() || !childItems().isEmpty());
+    }
 }
 
 void QQuickOverlay::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
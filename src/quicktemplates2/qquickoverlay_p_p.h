@@ -84,6 +84,7 @@ public:
 
     QVector<QQuickPopup *> stackingOrderPopups() const;
     QVector<QQuickDrawer *> stackingOrderDrawers() const;
+    void invalidateStackingOrder();
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
 
@@ -94,6 +95,11 @@ public:
     QVector<QQuickPopup *> allPopups;
     QVector<QQuickDrawer *> allDrawers;
     QPointer<QQuickPopup> mouseGrabberPopup;
+
+    // Lazily rebuilt when popups are added, removed, re-parented or re-stacked.
+    mutable bool stackingOrderDirty = true;
+    mutable QVector<QQuickPopup *> sortedPopups;
+    mutable QVector<QQuickDrawer *> sortedDrawers;
 };
 
 QT_END_NAMESPACE
@@ -39,6 +39,7 @@
 #include "qquickshortcutcontext_p_p.h"
 #include "qquickcontrol_p_p.h"
 #include "qquickpopup_p_p.h"
+#include "qquickpopuppositioner_p_p.h"
 #include "qquickdeferredexecute_p_p.h"
 
 #include <QtGui/private/qshortcutmap_p.h>
@@ -76,6 +77,9 @@ QQuickPopupItemPrivate::QQuickPopupItemPrivate(QQuickPopup *popup)
     : popup(popup)
 {
     isTabFence = true;
+    // the popup item is hidden until the popup is opened, and the
+    // delegates determine the implicit size used to position it
+    explicitLazyDelegates = true;
 }
 
 void QQuickPopupItemPrivate::implicitWidthChanged()
@@ -114,11 +118,15 @@ QQuickItem *QQuickPopupItemPrivate::getContentItem()
     return new QQuickItem(q);
 }
 
-static inline QString contentItemName() { return QStringLiteral("contentItem"); }
+static inline int contentItemIndex()
+{
+    static const int index = QQuickPopup::staticMetaObject.indexOfProperty("contentItem");
+    return index;
+}
 
 void QQuickPopupItemPrivate::cancelContentItem()
 {
-    quickCancelDeferred(popup, contentItemName());
+    quickCancelDeferred(popup, contentItemIndex());
 }
 
 void QQuickPopupItemPrivate::executeContentItem(bool complete)
@@ -127,16 +135,20 @@ void QQuickPopupItemPrivate::executeContentItem(bool complete)
         return;
 
     if (!contentItem || complete)
-        quickBeginDeferred(popup, contentItemName(), contentItem);
+        quickBeginDeferred(popup, contentItemIndex(), contentItem);
     if (complete)
-        quickCompleteDeferred(popup, contentItemName(), contentItem);
+        quickCompleteDeferred(popup, contentItem);
 }
 
-static inline QString backgroundName() { return QStringLiteral("background"); }
+static inline int backgroundIndex()
+{
+    static const int index = QQuickPopup::staticMetaObject.indexOfProperty("background");
+    return index;
+}
 
 void QQuickPopupItemPrivate::cancelBackground()
 {
-    quickCancelDeferred(popup, backgroundName());
+    quickCancelDeferred(popup, backgroundIndex());
 }
 
 void QQuickPopupItemPrivate::executeBackground(bool complete)
@@ -145,9 +157,9 @@ void QQuickPopupItemPrivate::executeBackground(bool complete)
         return;
 
     if (!background || complete)
-        quickBeginDeferred(popup, backgroundName(), background);
+        quickBeginDeferred(popup, backgroundIndex(), background);
     if (complete)
-        quickCompleteDeferred(popup, backgroundName(), background);
+        quickCompleteDeferred(popup, background);
 }
 
 QQuickPopupItem::QQuickPopupItem(QQuickPopup *popup)
@@ -199,7 +211,10 @@ void QQuickPopupItem::ungrabShortcut()
 void QQuickPopupItem::updatePolish()
 {
     Q_D(QQuickPopupItem);
-    return QQuickPopupPrivate::get(d->popup)->reposition();
+    QQuickControl::updatePolish();
+    QQuickPopupPrivate *p = QQuickPopupPrivate::get(d->popup);
+    if (p->positioner->isRepositionNeeded())
+        p->reposition();
 }
 
 bool QQuickPopupItem::event(QEvent *event)
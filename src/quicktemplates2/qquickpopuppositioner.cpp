@@ -96,10 +96,13 @@ void QQuickPopupPositioner::reposition()
         return;
 
     if (m_positioning) {
-        popupItem->polish();
+        scheduleReposition(false);
         return;
     }
 
+    m_repositionPending = false;
+    m_ancestorChangePending = false;
+
     const qreal w = popupItem->width();
     const qreal h = popupItem->height();
     const qreal iw = popupItem->implicitWidth();
@@ -213,6 +216,9 @@ void QQuickPopupPositioner::reposition()
 
     m_positioning = true;
 
+    if (m_parentItem)
+        m_parentSceneRect = m_parentItem->mapRectToScene(QRectF(0, 0, m_parentItem->width(), m_parentItem->height()));
+
     popupItem->setPosition(rect.topLeft());
 
     const QPointF effectivePos = m_parentItem ? m_parentItem->mapFromScene(rect.topLeft()) : rect.topLeft();
@@ -233,10 +239,50 @@ void QQuickPopupPositioner::reposition()
     m_positioning = false;
 }
 
-void QQuickPopupPositioner::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
+/*
+    Returns whether a scheduled reposition has to be performed when the popup
+    item is polished. Repositioning requests that originate from ancestor
+    geometry changes are dropped if the parent item ended up at the same place
+    in the scene, for example when a container is resized around it.
+*/
+bool QQuickPopupPositioner::isRepositionNeeded() const
 {
-    if (m_parentItem && m_popup->popupItem()->isVisible())
-        QQuickPopupPrivate::get(m_popup)->reposition();
+    if (m_repositionPending)
+        return true;
+    if (!m_ancestorChangePending || !m_parentItem)
+        return false;
+
+    return m_parentItem->mapRectToScene(QRectF(0, 0, m_parentItem->width(), m_parentItem->height())) != m_parentSceneRect;
+}
+
+void QQuickPopupPositioner::scheduleReposition(bool ancestorChanged)
+{
+    if (ancestorChanged)
+        m_ancestorChangePending = true;
+    else
+        m_repositionPending = true;
+    m_popup->popupItem()->polish();
+}
+
+static bool hasTransform(QQuickItem *item)
+{
+    return item->scale() != 1.0 || item->rotation() != 0.0 || !QQuickItemPrivate::get(item)->transforms.isEmpty();
+}
+
+void QQuickPopupPositioner::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &)
+{
+    if (!m_parentItem || !m_popup->popupItem()->isVisible())
+        return;
+
+    // The size of an untransformed ancestor alone does not affect the position of
+    // the parent item. If the parent item moves as a result, it is notified
+    // separately. A scale, rotation or transform is applied around a point that
+    // depends on the size, so resizing such an ancestor moves its children.
+    if (item != m_parentItem && !change.positionChange() && !hasTransform(item))
+        return;
+
+    // Coalesce the changes of all ancestors into a single reposition per frame.
+    scheduleReposition(true);
 }
 
 void QQuickPopupPositioner::itemParentChanged(QQuickItem *, QQuickItem *parent)
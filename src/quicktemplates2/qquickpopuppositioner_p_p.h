@@ -65,6 +65,7 @@ public:
     void setParentItem(QQuickItem *parent);
 
     virtual void reposition();
+    bool isRepositionNeeded() const;
 
 protected:
     void itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &) override;
@@ -74,8 +75,12 @@ protected:
 private:
     void removeAncestorListeners(QQuickItem *item);
     void addAncestorListeners(QQuickItem *item);
+    void scheduleReposition(bool ancestorChanged);
 
     bool m_positioning = false;
+    bool m_repositionPending = false;
+    bool m_ancestorChangePending = false;
+    QRectF m_parentSceneRect;
     QQuickItem *m_parentItem = nullptr;
     QQuickPopup *m_popup = nullptr;
 };
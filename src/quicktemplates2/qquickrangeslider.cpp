@@ -150,12 +150,16 @@ void QQuickRangeSliderNodePrivate::updatePosition(bool ignoreOtherPosition)
     setPosition(pos, ignoreOtherPosition);
 }
 
-static inline QString handleName() { return QStringLiteral("handle"); }
+static inline int handleIndex()
+{
+    static const int index = QQuickRangeSliderNode::staticMetaObject.indexOfProperty("handle");
+    return index;
+}
 
 void QQuickRangeSliderNodePrivate::cancelHandle()
 {
     Q_Q(QQuickRangeSliderNode);
-    quickCancelDeferred(q, handleName());
+    quickCancelDeferred(q, handleIndex());
 }
 
 void QQuickRangeSliderNodePrivate::executeHandle(bool complete)
@@ -165,9 +169,9 @@ void QQuickRangeSliderNodePrivate::executeHandle(bool complete)
         return;
 
     if (!handle || complete)
-        quickBeginDeferred(q, handleName(), handle);
+        quickBeginDeferred(q, handleIndex(), handle);
     if (complete)
-        quickCompleteDeferred(q, handleName(), handle);
+        quickCompleteDeferred(q, handle);
 }
 
 QQuickRangeSliderNodePrivate *QQuickRangeSliderNodePrivate::get(QQuickRangeSliderNode *node)
@@ -249,8 +253,9 @@ qreal QQuickRangeSliderNode::visualPosition() const
 QQuickItem *QQuickRangeSliderNode::handle() const
 {
     QQuickRangeSliderNodePrivate *d = const_cast<QQuickRangeSliderNodePrivate *>(d_func());
-    if (!d->handle)
-        d->executeHandle();
+    QQuickControlPrivate *p = QQuickControlPrivate::get(d->slider);
+    if (!d->handle && !p->deferDelegates())
+        d->executeHandle(p->componentComplete);
     return d->handle;
 }
 
@@ -360,6 +365,8 @@ public:
 
     void updateHover(const QPointF &pos);
 
+    void executeDelegates(bool notify = false) override;
+
     bool live = true;
     qreal from = defaultFrom;
     qreal to = defaultTo;
@@ -559,6 +566,19 @@ void QQuickRangeSliderPrivate::updateHover(const QPointF &pos)
     second->setHovered(secondHandle && secondHandle->isEnabled() && secondHandle->contains(q->mapToItem(secondHandle, pos)));
 }
 
+void QQuickRangeSliderPrivate::executeDelegates(bool notify)
+{
+    QQuickRangeSliderNodePrivate *firstPrivate = QQuickRangeSliderNodePrivate::get(first);
+    QQuickRangeSliderNodePrivate *secondPrivate = QQuickRangeSliderNodePrivate::get(second);
+    firstPrivate->executeHandle(true);
+    secondPrivate->executeHandle(true);
+    if (notify && firstPrivate->handle)
+        emit first->handleChanged();
+    if (notify && secondPrivate->handle)
+        emit second->handleChanged();
+    QQuickControlPrivate::executeDelegates(notify);
+}
+
 QQuickRangeSlider::QQuickRangeSlider(QQuickItem *parent)
     : QQuickControl(*(new QQuickRangeSliderPrivate), parent)
 {
@@ -1103,8 +1123,6 @@ void QQuickRangeSlider::componentComplete()
     Q_D(QQuickRangeSlider);
     QQuickRangeSliderNodePrivate *firstPrivate = QQuickRangeSliderNodePrivate::get(d->first);
     QQuickRangeSliderNodePrivate *secondPrivate = QQuickRangeSliderNodePrivate::get(d->second);
-    firstPrivate->executeHandle(true);
-    secondPrivate->executeHandle(true);
 
     QQuickControl::componentComplete();
 
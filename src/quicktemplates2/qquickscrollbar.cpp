@@ -710,6 +710,14 @@ void QQuickScrollBar::mousePressEvent(QMouseEvent *event)
     d->handleMove(event->localPos());
 }
 
+void QQuickScrollBar::updatePolish()
+{
+    Q_D(QQuickScrollBar);
+    QQuickControl::updatePolish();
+    if (d->attached)
+        d->attached->updatePolish(this);
+}
+
 #if QT_CONFIG(quicktemplates2_hover)
 void QQuickScrollBar::hoverChange()
 {
@@ -748,6 +756,10 @@ void QQuickScrollBarAttachedPrivate::setFlickable(QQuickFlickable *item)
     }
 
     flickable = item;
+    horizontalLayoutPending = false;
+    horizontalMovePending = false;
+    verticalLayoutPending = false;
+    verticalMovePending = false;
 
     if (item) {
         QQuickItemPrivate::get(item)->updateOrAddGeometryChangeListener(this, QQuickGeometryChange::Size);
@@ -893,6 +905,52 @@ void QQuickScrollBarAttachedPrivate::layoutVertical(bool move)
         vertical->setX(vertical->isMirrored() ? 0 : flickable->width() - vertical->width());
 }
 
+// Flickable size changes are coalesced and applied in the polish pass of the
+// respective scroll bar, so that a Flickable that is resized several times
+// during a frame (for example, first its width and then its height by an
+// anchor or layout) lays out its attached scroll bars only once.
+void QQuickScrollBarAttachedPrivate::scheduleLayoutHorizontal(bool move)
+{
+    Q_ASSERT(horizontal && flickable);
+    if (horizontal->parentItem() != flickable)
+        return;
+    horizontalMovePending |= move;
+    if (horizontalLayoutPending)
+        return;
+    horizontalLayoutPending = true;
+    horizontal->polish();
+}
+
+void QQuickScrollBarAttachedPrivate::scheduleLayoutVertical(bool move)
+{
+    Q_ASSERT(vertical && flickable);
+    if (vertical->parentItem() != flickable)
+        return;
+    verticalMovePending |= move;
+    if (verticalLayoutPending)
+        return;
+    verticalLayoutPending = true;
+    vertical->polish();
+}
+
+void QQuickScrollBarAttachedPrivate::updatePolish(QQuickScrollBar *bar)
+{
+    if (bar == horizontal && horizontalLayoutPending) {
+        const bool move = horizontalMovePending;
+        horizontalLayoutPending = false;
+        horizontalMovePending = false;
+        if (flickable)
+            layoutHorizontal(move);
+    }
+    if (bar == vertical && verticalLayoutPending) {
+        const bool move = verticalMovePending;
+        verticalLayoutPending = false;
+        verticalMovePending = false;
+        if (flickable)
+            layoutVertical(move);
+    }
+}
+
 void QQuickScrollBarAttachedPrivate::itemGeometryChanged(QQuickItem *item, const QQuickGeometryChange change, const QRectF &diff)
 {
     Q_UNUSED(item);
@@ -904,7 +962,7 @@ void QQuickScrollBarAttachedPrivate::itemGeometryChanged(QQuickItem *item, const
         bool move = qFuzzyIsNull(horizontal->y()) || qFuzzyCompare(horizontal->y(), item->height() - diff.height() - horizontal->height());
 #endif
         if (flickable)
-            layoutHorizontal(move);
+            scheduleLayoutHorizontal(move);
     }
     if (vertical && vertical->width() > 0) {
 #ifdef QT_QUICK_NEW_GEOMETRY_CHANGED_HANDLING // TODO: correct/rename diff to oldGeometry
@@ -913,7 +971,7 @@ void QQuickScrollBarAttachedPrivate::itemGeometryChanged(QQuickItem *item, const
         bool move = qFuzzyIsNull(vertical->x()) || qFuzzyCompare(vertical->x(), item->width() - diff.width() - vertical->width());
 #endif
         if (flickable)
-            layoutVertical(move);
+            scheduleLayoutVertical(move);
     }
 }
 
@@ -931,10 +989,14 @@ void QQuickScrollBarAttachedPrivate::itemImplicitHeightChanged(QQuickItem *item)
 
 void QQuickScrollBarAttachedPrivate::itemDestroyed(QQuickItem *item)
 {
-    if (item == horizontal)
+    if (item == horizontal) {
         horizontal = nullptr;
-    if (item == vertical)
+        horizontalLayoutPending = false;
+    }
+    if (item == vertical) {
         vertical = nullptr;
+        verticalLayoutPending = false;
+    }
 }
 
 QQuickScrollBarAttached::QQuickScrollBarAttached(QObject *parent)
@@ -952,10 +1014,16 @@ QQuickScrollBarAttached::~QQuickScrollBarAttached()
     Q_D(QQuickScrollBarAttached);
     if (d->horizontal) {
         QQuickItemPrivate::get(d->horizontal)->removeItemChangeListener(d, horizontalChangeTypes);
+        QQuickScrollBarPrivate *p = QQuickScrollBarPrivate::get(d->horizontal);
+        if (p->attached == d)
+            p->attached = nullptr;
         d->horizontal = nullptr;
     }
     if (d->vertical) {
         QQuickItemPrivate::get(d->vertical)->removeItemChangeListener(d, verticalChangeTypes);
+        QQuickScrollBarPrivate *p = QQuickScrollBarPrivate::get(d->vertical);
+        if (p->attached == d)
+            p->attached = nullptr;
         d->vertical = nullptr;
     }
     d->setFlickable(nullptr);
@@ -989,6 +1057,9 @@ void QQuickScrollBarAttached::setHorizontal(QQuickScrollBar *horizontal)
 
     if (d->horizontal) {
         QQuickItemPrivate::get(d->horizontal)->removeItemChangeListener(d, horizontalChangeTypes);
+        QQuickScrollBarPrivate *p = QQuickScrollBarPrivate::get(d->horizontal);
+        if (p->attached == d)
+            p->attached = nullptr;
         QObjectPrivate::disconnect(d->horizontal, &QQuickScrollBar::positionChanged, d, &QQuickScrollBarAttachedPrivate::scrollHorizontal);
 
         if (d->flickable)
@@ -996,6 +1067,8 @@ void QQuickScrollBarAttached::setHorizontal(QQuickScrollBar *horizontal)
     }
 
     d->horizontal = horizontal;
+    d->horizontalLayoutPending = false;
+    d->horizontalMovePending = false;
 
     if (horizontal) {
         if (!horizontal->parentItem())
@@ -1003,6 +1076,7 @@ void QQuickScrollBarAttached::setHorizontal(QQuickScrollBar *horizontal)
         horizontal->setOrientation(Qt::Horizontal);
 
         QQuickItemPrivate::get(horizontal)->addItemChangeListener(d, horizontalChangeTypes);
+        QQuickScrollBarPrivate::get(horizontal)->attached = d;
         QObjectPrivate::connect(horizontal, &QQuickScrollBar::positionChanged, d, &QQuickScrollBarAttachedPrivate::scrollHorizontal);
 
         if (d->flickable)
@@ -1039,6 +1113,9 @@ void QQuickScrollBarAttached::setVertical(QQuickScrollBar *vertical)
 
     if (d->vertical) {
         QQuickItemPrivate::get(d->vertical)->removeItemChangeListener(d, verticalChangeTypes);
+        QQuickScrollBarPrivate *p = QQuickScrollBarPrivate::get(d->vertical);
+        if (p->attached == d)
+            p->attached = nullptr;
         QObjectPrivate::disconnect(d->vertical, &QQuickScrollBar::mirroredChanged, d, &QQuickScrollBarAttachedPrivate::mirrorVertical);
         QObjectPrivate::disconnect(d->vertical, &QQuickScrollBar::positionChanged, d, &QQuickScrollBarAttachedPrivate::scrollVertical);
 
@@ -1047,6 +1124,8 @@ void QQuickScrollBarAttached::setVertical(QQuickScrollBar *vertical)
     }
 
     d->vertical = vertical;
+    d->verticalLayoutPending = false;
+    d->verticalMovePending = false;
 
     if (vertical) {
         if (!vertical->parentItem())
@@ -1054,6 +1133,7 @@ void QQuickScrollBarAttached::setVertical(QQuickScrollBar *vertical)
         vertical->setOrientation(Qt::Vertical);
 
         QQuickItemPrivate::get(vertical)->addItemChangeListener(d, verticalChangeTypes);
+        QQuickScrollBarPrivate::get(vertical)->attached = d;
         QObjectPrivate::connect(vertical, &QQuickScrollBar::mirroredChanged, d, &QQuickScrollBarAttachedPrivate::mirrorVertical);
         QObjectPrivate::connect(vertical, &QQuickScrollBar::positionChanged, d, &QQuickScrollBarAttachedPrivate::scrollVertical);
 
@@ -156,6 +156,7 @@ Q_SIGNALS:
 
 protected:
     void mousePressEvent(QMouseEvent *event) override;
+    void updatePolish() override;
 
 #if QT_CONFIG(quicktemplates2_hover)
     void hoverChange() override;
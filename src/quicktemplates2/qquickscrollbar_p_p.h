@@ -54,6 +54,8 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQuickScrollBarAttachedPrivate;
+
 class QQuickFlickable;
 
 class QQuickScrollBarPrivate : public QQuickControlPrivate
@@ -103,6 +105,7 @@ public:
     Qt::Orientation orientation = Qt::Vertical;
     QQuickScrollBar::SnapMode snapMode = QQuickScrollBar::NoSnap;
     QQuickScrollBar::Policy policy = QQuickScrollBar::AsNeeded;
+    QQuickScrollBarAttachedPrivate *attached = nullptr;
 };
 
 class QQuickScrollBarAttachedPrivate : public QObjectPrivate, public QQuickItemChangeListener
@@ -127,6 +130,9 @@ public:
 
     void layoutHorizontal(bool move = true);
     void layoutVertical(bool move = true);
+    void scheduleLayoutHorizontal(bool move);
+    void scheduleLayoutVertical(bool move);
+    void updatePolish(QQuickScrollBar *bar);
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
     void itemImplicitWidthChanged(QQuickItem *item) override;
@@ -136,6 +142,10 @@ public:
     QQuickFlickable *flickable = nullptr;
     QQuickScrollBar *horizontal = nullptr;
     QQuickScrollBar *vertical = nullptr;
+    bool horizontalLayoutPending = false;
+    bool horizontalMovePending = false;
+    bool verticalLayoutPending = false;
+    bool verticalMovePending = false;
 };
 
 QT_END_NAMESPACE
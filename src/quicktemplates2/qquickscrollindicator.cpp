@@ -130,11 +130,18 @@ static const QQuickItemPrivate::ChangeTypes changeTypes = QQuickItemPrivate::Geo
 static const QQuickItemPrivate::ChangeTypes horizontalChangeTypes = changeTypes | QQuickItemPrivate::ImplicitHeight;
 static const QQuickItemPrivate::ChangeTypes verticalChangeTypes = changeTypes | QQuickItemPrivate::ImplicitWidth;
 
+class QQuickScrollIndicatorAttachedPrivate;
+
 class QQuickScrollIndicatorPrivate : public QQuickControlPrivate
 {
     Q_DECLARE_PUBLIC(QQuickScrollIndicator)
 
 public:
+    static QQuickScrollIndicatorPrivate *get(QQuickScrollIndicator *indicator)
+    {
+        return indicator->d_func();
+    }
+
     struct VisualArea
     {
         VisualArea(qreal pos, qreal sz)
@@ -152,6 +159,7 @@ public:
     qreal position = 0;
     bool active = false;
     Qt::Orientation orientation = Qt::Vertical;
+    QQuickScrollIndicatorAttachedPrivate *attached = nullptr;
 };
 
 QQuickScrollIndicatorPrivate::VisualArea QQuickScrollIndicatorPrivate::visualArea() const
@@ -423,6 +431,9 @@ public:
 
     void layoutHorizontal(bool move = true);
     void layoutVertical(bool move = true);
+    void scheduleLayoutHorizontal(bool move);
+    void scheduleLayoutVertical(bool move);
+    void updatePolish(QQuickScrollIndicator *indicator);
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
     void itemImplicitWidthChanged(QQuickItem *item) override;
@@ -432,6 +443,10 @@ public:
     QQuickFlickable *flickable = nullptr;
     QQuickScrollIndicator *horizontal = nullptr;
     QQuickScrollIndicator *vertical = nullptr;
+    bool horizontalLayoutPending = false;
+    bool horizontalMovePending = false;
+    bool verticalLayoutPending = false;
+    bool verticalMovePending = false;
 };
 
 void QQuickScrollIndicatorAttachedPrivate::activateHorizontal()
@@ -464,6 +479,46 @@ void QQuickScrollIndicatorAttachedPrivate::layoutVertical(bool move)
         vertical->setX(flickable->width() - vertical->width());
 }
 
+void QQuickScrollIndicatorAttachedPrivate::scheduleLayoutHorizontal(bool move)
+{
+    Q_ASSERT(horizontal && flickable);
+    if (horizontal->parentItem() != flickable)
+        return;
+    horizontalMovePending |= move;
+    if (horizontalLayoutPending)
+        return;
+    horizontalLayoutPending = true;
+    horizontal->polish();
+}
+
+void QQuickScrollIndicatorAttachedPrivate::scheduleLayoutVertical(bool move)
+{
+    Q_ASSERT(vertical && flickable);
+    if (vertical->parentItem() != flickable)
+        return;
+    verticalMovePending |= move;
+    if (verticalLayoutPending)
+        return;
+    verticalLayoutPending = true;
+    vertical->polish();
+}
+
+void QQuickScrollIndicatorAttachedPrivate::updatePolish(QQuickScrollIndicator *indicator)
+{
+    if (indicator == horizontal && horizontalLayoutPending) {
+        const bool move = horizontalMovePending;
+        horizontalLayoutPending = false;
+        horizontalMovePending = false;
+        layoutHorizontal(move);
+    }
+    if (indicator == vertical && verticalLayoutPending) {
+        const bool move = verticalMovePending;
+        verticalLayoutPending = false;
+        verticalMovePending = false;
+        layoutVertical(move);
+    }
+}
+
 void QQuickScrollIndicatorAttachedPrivate::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff)
 {
     Q_UNUSED(item);
@@ -474,7 +529,7 @@ void QQuickScrollIndicatorAttachedPrivate::itemGeometryChanged(QQuickItem *item,
 #else
         bool move = qFuzzyIsNull(horizontal->y()) || qFuzzyCompare(horizontal->y(), item->height() - diff.height() - horizontal->height());
 #endif
-        layoutHorizontal(move);
+        scheduleLayoutHorizontal(move);
     }
     if (vertical && vertical->width() > 0) {
 #ifdef QT_QUICK_NEW_GEOMETRY_CHANGED_HANDLING // TODO: correct/rename diff to oldGeometry
@@ -482,7 +537,7 @@ void QQuickScrollIndicatorAttachedPrivate::itemGeometryChanged(QQuickItem *item,
 #else
         bool move = qFuzzyIsNull(vertical->x()) || qFuzzyCompare(vertical->x(), item->width() - diff.width() - vertical->width());
 #endif
-        layoutVertical(move);
+        scheduleLayoutVertical(move);
     }
 }
 
@@ -500,10 +555,14 @@ void QQuickScrollIndicatorAttachedPrivate::itemImplicitHeightChanged(QQuickItem
 
 void QQuickScrollIndicatorAttachedPrivate::itemDestroyed(QQuickItem *item)
 {
-    if (item == horizontal)
+    if (item == horizontal) {
         horizontal = nullptr;
-    if (item == vertical)
+        horizontalLayoutPending = false;
+    }
+    if (item == vertical) {
         vertical = nullptr;
+        verticalLayoutPending = false;
+    }
 }
 
 QQuickScrollIndicatorAttached::QQuickScrollIndicatorAttached(QObject *parent)
@@ -521,10 +580,18 @@ QQuickScrollIndicatorAttached::~QQuickScrollIndicatorAttached()
 {
     Q_D(QQuickScrollIndicatorAttached);
     if (d->flickable) {
-        if (d->horizontal)
+        if (d->horizontal) {
             QQuickItemPrivate::get(d->horizontal)->removeItemChangeListener(d, horizontalChangeTypes);
-        if (d->vertical)
+            QQuickScrollIndicatorPrivate *p = QQuickScrollIndicatorPrivate::get(d->horizontal);
+            if (p->attached == d)
+                p->attached = nullptr;
+        }
+        if (d->vertical) {
             QQuickItemPrivate::get(d->vertical)->removeItemChangeListener(d,verticalChangeTypes);
+            QQuickScrollIndicatorPrivate *p = QQuickScrollIndicatorPrivate::get(d->vertical);
+            if (p->attached == d)
+                p->attached = nullptr;
+        }
         // NOTE: Use removeItemChangeListener(Geometry) instead of updateOrRemoveGeometryChangeListener(Size).
         // The latter doesn't remove the listener but only resets its types. Thus, it leaves behind a dangling
         // pointer on destruction.
@@ -560,6 +627,9 @@ void QQuickScrollIndicatorAttached::setHorizontal(QQuickScrollIndicator *horizon
 
     if (d->horizontal && d->flickable) {
         QQuickItemPrivate::get(d->horizontal)->removeItemChangeListener(d, horizontalChangeTypes);
+        QQuickScrollIndicatorPrivate *p = QQuickScrollIndicatorPrivate::get(d->horizontal);
+        if (p->attached == d)
+            p->attached = nullptr;
         QObjectPrivate::disconnect(d->flickable, &QQuickFlickable::movingHorizontallyChanged, d, &QQuickScrollIndicatorAttachedPrivate::activateHorizontal);
 
         // TODO: export QQuickFlickableVisibleArea
@@ -569,6 +639,8 @@ void QQuickScrollIndicatorAttached::setHorizontal(QQuickScrollIndicator *horizon
     }
 
     d->horizontal = horizontal;
+    d->horizontalLayoutPending = false;
+    d->horizontalMovePending = false;
 
     if (horizontal && d->flickable) {
         if (!horizontal->parentItem())
@@ -576,6 +648,7 @@ void QQuickScrollIndicatorAttached::setHorizontal(QQuickScrollIndicator *horizon
         horizontal->setOrientation(Qt::Horizontal);
 
         QQuickItemPrivate::get(horizontal)->addItemChangeListener(d, horizontalChangeTypes);
+        QQuickScrollIndicatorPrivate::get(horizontal)->attached = d;
         QObjectPrivate::connect(d->flickable, &QQuickFlickable::movingHorizontallyChanged, d, &QQuickScrollIndicatorAttachedPrivate::activateHorizontal);
 
         // TODO: export QQuickFlickableVisibleArea
@@ -618,6 +691,9 @@ void QQuickScrollIndicatorAttached::setVertical(QQuickScrollIndicator *vertical)
 
     if (d->vertical && d->flickable) {
         QQuickItemPrivate::get(d->vertical)->removeItemChangeListener(d, verticalChangeTypes);
+        QQuickScrollIndicatorPrivate *p = QQuickScrollIndicatorPrivate::get(d->vertical);
+        if (p->attached == d)
+            p->attached = nullptr;
         QObjectPrivate::disconnect(d->flickable, &QQuickFlickable::movingVerticallyChanged, d, &QQuickScrollIndicatorAttachedPrivate::activateVertical);
 
         // TODO: export QQuickFlickableVisibleArea
@@ -627,6 +703,8 @@ void QQuickScrollIndicatorAttached::setVertical(QQuickScrollIndicator *vertical)
     }
 
     d->vertical = vertical;
+    d->verticalLayoutPending = false;
+    d->verticalMovePending = false;
 
     if (vertical && d->flickable) {
         if (!vertical->parentItem())
@@ -634,6 +712,7 @@ void QQuickScrollIndicatorAttached::setVertical(QQuickScrollIndicator *vertical)
         vertical->setOrientation(Qt::Vertical);
 
         QQuickItemPrivate::get(vertical)->addItemChangeListener(d, verticalChangeTypes);
+        QQuickScrollIndicatorPrivate::get(vertical)->attached = d;
         QObjectPrivate::connect(d->flickable, &QQuickFlickable::movingVerticallyChanged, d, &QQuickScrollIndicatorAttachedPrivate::activateVertical);
 
         // TODO: export QQuickFlickableVisibleArea
@@ -648,6 +727,14 @@ void QQuickScrollIndicatorAttached::setVertical(QQuickScrollIndicator *vertical)
     emit verticalChanged();
 }
 
+void QQuickScrollIndicator::updatePolish()
+{
+    Q_D(QQuickScrollIndicator);
+    QQuickControl::updatePolish();
+    if (d->attached)
+        d->attached->updatePolish(this);
+}
+
 #if QT_CONFIG(quicktemplates2_multitouch)
 void QQuickScrollIndicator::touchEvent(QTouchEvent *event)
 {
@@ -111,6 +111,8 @@ Q_SIGNALS:
     Q_REVISION(4) void visualPositionChanged();
 
 protected:
+    void updatePolish() override;
+
 #if QT_CONFIG(quicktemplates2_multitouch)
     void touchEvent(QTouchEvent *event) override;
 #endif
@@ -105,6 +105,8 @@ public:
     void cancelHandle();
     void executeHandle(bool complete = false);
 
+    void executeDelegates(bool notify = false) override;
+
     qreal from = 0;
     qreal to = 1;
     qreal value = 0;
@@ -228,12 +230,16 @@ void QQuickSliderPrivate::handleUngrab()
     q->setPressed(false);
 }
 
-static inline QString handleName() { return QStringLiteral("handle"); }
+static inline int handleIndex()
+{
+    static const int index = QQuickSlider::staticMetaObject.indexOfProperty("handle");
+    return index;
+}
 
 void QQuickSliderPrivate::cancelHandle()
 {
     Q_Q(QQuickSlider);
-    quickCancelDeferred(q, handleName());
+    quickCancelDeferred(q, handleIndex());
 }
 
 void QQuickSliderPrivate::executeHandle(bool complete)
@@ -243,9 +249,18 @@ void QQuickSliderPrivate::executeHandle(bool complete)
         return;
 
     if (!handle || complete)
-        quickBeginDeferred(q, handleName(), handle);
+        quickBeginDeferred(q, handleIndex(), handle);
     if (complete)
-        quickCompleteDeferred(q, handleName(), handle);
+        quickCompleteDeferred(q, handle);
+}
+
+void QQuickSliderPrivate::executeDelegates(bool notify)
+{
+    Q_Q(QQuickSlider);
+    executeHandle(true);
+    if (notify && handle)
+        emit q->handleChanged();
+    QQuickControlPrivate::executeDelegates(notify);
 }
 
 QQuickSlider::QQuickSlider(QQuickItem *parent)
@@ -535,8 +550,8 @@ void QQuickSlider::setOrientation(Qt::Orientation orientation)
 QQuickItem *QQuickSlider::handle() const
 {
     QQuickSliderPrivate *d = const_cast<QQuickSliderPrivate *>(d_func());
-    if (!d->handle)
-        d->executeHandle();
+    if (!d->handle && !d->deferDelegates())
+        d->executeHandle(d->componentComplete);
     return d->handle;
 }
 
@@ -748,7 +763,6 @@ void QQuickSlider::mirrorChange()
 void QQuickSlider::componentComplete()
 {
     Q_D(QQuickSlider);
-    d->executeHandle(true);
     QQuickControl::componentComplete();
     setValue(d->value);
     d->updatePosition();
@@ -135,6 +135,8 @@ public:
     void handleRelease(const QPointF &point) override;
     void handleUngrab() override;
 
+    void executeDelegates(bool notify = false) override;
+
     bool editable = false;
     bool wrap = false;
     int from = 0;
@@ -952,9 +954,6 @@ void QQuickSpinBox::classBegin()
 void QQuickSpinBox::componentComplete()
 {
     Q_D(QQuickSpinBox);
-    QQuickSpinButtonPrivate::get(d->up)->executeIndicator(true);
-    QQuickSpinButtonPrivate::get(d->down)->executeIndicator(true);
-
     QQuickControl::componentComplete();
     if (!d->setValue(d->value, /* allowWrap = */ false, /* modified = */ false)) {
         d->updateDisplayText();
@@ -1024,12 +1023,16 @@ void QQuickSpinBox::accessibilityActiveChanged(bool active)
 }
 #endif
 
-static inline QString indicatorName() { return QStringLiteral("indicator"); }
+static inline int indicatorIndex()
+{
+    static const int index = QQuickSpinButton::staticMetaObject.indexOfProperty("indicator");
+    return index;
+}
 
 void QQuickSpinButtonPrivate::cancelIndicator()
 {
     Q_Q(QQuickSpinButton);
-    quickCancelDeferred(q, indicatorName());
+    quickCancelDeferred(q, indicatorIndex());
 }
 
 void QQuickSpinButtonPrivate::executeIndicator(bool complete)
@@ -1039,9 +1042,22 @@ void QQuickSpinButtonPrivate::executeIndicator(bool complete)
         return;
 
     if (!indicator || complete)
-        quickBeginDeferred(q, indicatorName(), indicator);
+        quickBeginDeferred(q, indicatorIndex(), indicator);
     if (complete)
-        quickCompleteDeferred(q, indicatorName(), indicator);
+        quickCompleteDeferred(q, indicator);
+}
+
+void QQuickSpinBoxPrivate::executeDelegates(bool notify)
+{
+    QQuickSpinButtonPrivate *upPrivate = QQuickSpinButtonPrivate::get(up);
+    QQuickSpinButtonPrivate *downPrivate = QQuickSpinButtonPrivate::get(down);
+    upPrivate->executeIndicator(true);
+    downPrivate->executeIndicator(true);
+    if (notify && upPrivate->indicator)
+        emit up->indicatorChanged();
+    if (notify && downPrivate->indicator)
+        emit down->indicatorChanged();
+    QQuickControlPrivate::executeDelegates(notify);
 }
 
 QQuickSpinButton::QQuickSpinButton(QQuickSpinBox *parent)
@@ -1068,8 +1084,9 @@ void QQuickSpinButton::setPressed(bool pressed)
 QQuickItem *QQuickSpinButton::indicator() const
 {
     QQuickSpinButtonPrivate *d = const_cast<QQuickSpinButtonPrivate *>(d_func());
-    if (!d->indicator)
-        d->executeIndicator();
+    QQuickControlPrivate *p = QQuickControlPrivate::get(static_cast<QQuickSpinBox *>(parent()));
+    if (!d->indicator && !p->deferDelegates())
+        d->executeIndicator(p->componentComplete);
     return d->indicator;
 }
 
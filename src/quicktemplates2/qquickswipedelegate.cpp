@@ -136,6 +136,7 @@ class QQuickSwipePrivate : public QObjectPrivate
 
 public:
     QQuickSwipePrivate(QQuickSwipeDelegate *control) : control(control) { }
+    ~QQuickSwipePrivate();
 
     static QQuickSwipePrivate *get(QQuickSwipe *swipe);
 
@@ -150,6 +151,10 @@ public:
     void createAndShowBehindItem();
     void createAndShowRightItem();
 
+    void addToPool();
+    void removeFromPool();
+    void releaseItems();
+
     void warnAboutMixingDelegates();
     void warnAboutSettingDelegatesWhileVisible();
 
@@ -178,8 +183,19 @@ public:
     QQuickItem *rightItem = nullptr;
     QQuickTransition *transition = nullptr;
     QScopedPointer<QQuickSwipeTransitionManager> transitionManager;
+    // The view in whose pool of closed swipes this swipe is, if any.
+    QQuickItem *poolView = nullptr;
 };
 
+// The left, right and behind items of closed swipes are kept alive only for the
+// most recently closed swipe delegates of each view (the parent item of the
+// delegates, such as the content item of a ListView), so that swiping many rows
+// doesn't accumulate an action item for every row that was ever swiped.
+static const int maxPooledSwipesPerView = 5;
+
+typedef QHash<QQuickItem *, QVector<QQuickSwipePrivate *> > QQuickSwipePool;
+Q_GLOBAL_STATIC(QQuickSwipePool, swipePool)
+
 QQuickSwipeTransitionManager::QQuickSwipeTransitionManager(QQuickSwipe *swipe)
     : m_swipe(swipe)
 {
@@ -207,6 +223,11 @@ void QQuickSwipeTransitionManager::finished()
     QQuickSwipePrivate::get(m_swipe)->finishTransition();
 }
 
+QQuickSwipePrivate::~QQuickSwipePrivate()
+{
+    removeFromPool();
+}
+
 QQuickSwipePrivate *QQuickSwipePrivate::get(QQuickSwipe *swipe)
 {
     return swipe->d_func();
@@ -298,6 +319,10 @@ QQuickItem *QQuickSwipePrivate::createRelevantItemForDistance(qreal distance)
 
 void QQuickSwipePrivate::reposition(PositionAnimation animationPolicy)
 {
+    // The items of a swipe that is being used again must not be released.
+    if (!qFuzzyIsNull(position))
+        removeFromPool();
+
     QQuickItem *relevantItem = showRelevantItemForPosition(position);
     const qreal relevantWidth = relevantItem ? relevantItem->width() : 0.0;
     const qreal contentItemX = position * relevantWidth + control->leftPadding();
@@ -379,6 +404,46 @@ void QQuickSwipePrivate::createAndShowRightItem()
         leftItem->setVisible(false);
 }
 
+void QQuickSwipePrivate::addToPool()
+{
+    removeFromPool();
+
+    QQuickItem *view = control->parentItem();
+    if (!view || (!leftItem && !behindItem && !rightItem))
+        return;
+
+    QVector<QQuickSwipePrivate *> &swipes = (*swipePool())[view];
+    swipes.append(this);
+    poolView = view;
+
+    if (swipes.count() > maxPooledSwipesPerView)
+        swipes.first()->releaseItems();
+}
+
+void QQuickSwipePrivate::removeFromPool()
+{
+    if (!poolView || !swipePool.exists())
+        return;
+
+    QQuickSwipePool::iterator it = swipePool->find(poolView);
+    if (it != swipePool->end()) {
+        it->removeOne(this);
+        if (it->isEmpty())
+            swipePool->erase(it);
+    }
+    poolView = nullptr;
+}
+
+void QQuickSwipePrivate::releaseItems()
+{
+    Q_Q(QQuickSwipe);
+    removeFromPool();
+    // They are created again the next time that the control is swiped.
+    q->setLeftItem(nullptr);
+    q->setBehindItem(nullptr);
+    q->setRightItem(nullptr);
+}
+
 void QQuickSwipePrivate::warnAboutMixingDelegates()
 {
     qmlWarning(control) << "cannot set both behind and left/right properties";
@@ -418,10 +483,13 @@ void QQuickSwipePrivate::finishTransition()
 {
     Q_Q(QQuickSwipe);
     q->setComplete(qFuzzyCompare(qAbs(position), qreal(1.0)));
-    if (complete)
+    if (complete) {
         emit q->opened();
-    else
+    } else {
+        if (qFuzzyIsNull(position))
+            addToPool();
         emit q->closed();
+    }
 }
 
 QQuickSwipe::QQuickSwipe(QQuickSwipeDelegate *control)
@@ -728,8 +796,9 @@ bool QQuickSwipeDelegatePrivate::handleMousePressEvent(QQuickItem *item, QMouseE
     // (the control can be clicked to e.g. close the swipe). Either way, we must begin measuring
     // mouse movement in case it turns into a swipe, in which case we grab the mouse.
     swipePrivate->positionBeforePress = swipePrivate->position;
-    swipePrivate->velocityCalculator.startMeasuring(event->pos(), event->timestamp());
-    setPressPoint(item->mapToItem(q, event->pos()));
+    const QPointF mappedEventPos = item->mapToItem(q, event->pos());
+    swipePrivate->velocityCalculator.startMeasuring(mappedEventPos, event->timestamp());
+    setPressPoint(mappedEventPos);
 
     // When a delegate uses the attached properties and signals, it declares that it wants mouse events.
     Attached *attached = attachedObject(item);
@@ -771,6 +840,7 @@ bool QQuickSwipeDelegatePrivate::handleMouseMoveEvent(QQuickItem *item, QMouseEv
         return false;
 
     const QPointF mappedEventPos = item->mapToItem(q, event->pos());
+    swipePrivate->velocityCalculator.updateMeasuring(mappedEventPos, event->timestamp());
     const qreal distance = (mappedEventPos - pressPoint).x();
     if (!q->keepMouseGrab()) {
         // Taken from QQuickDrawerPrivate::grabMouse; see comments there.
@@ -858,7 +928,7 @@ bool QQuickSwipeDelegatePrivate::handleMouseReleaseEvent(QQuickItem *item, QMous
 {
     Q_Q(QQuickSwipeDelegate);
     QQuickSwipePrivate *swipePrivate = QQuickSwipePrivate::get(&swipe);
-    swipePrivate->velocityCalculator.stopMeasuring(event->pos(), event->timestamp());
+    swipePrivate->velocityCalculator.stopMeasuring(item->mapToItem(q, event->pos()), event->timestamp());
 
     const bool hadGrabbedMouse = q->keepMouseGrab();
     q->setKeepMouseGrab(false);
@@ -1085,18 +1155,24 @@ QQuickSwipeDelegate::QQuickSwipeDelegate(QQuickItem *parent)
 
             If \c left has not been set, or the position hasn't changed since
             creation of the SwipeDelegate, this property will be \c null.
+
+            \include qquickswipedelegate-item-lifetime.qdocinc
     \row
         \li behindItem
         \li This read-only property holds the item instantiated from the \c behind component.
 
             If \c behind has not been set, or the position hasn't changed since
             creation of the SwipeDelegate, this property will be \c null.
+
+            \include qquickswipedelegate-item-lifetime.qdocinc
     \row
         \li rightItem
         \li This read-only property holds the item instantiated from the \c right component.
 
             If \c right has not been set, or the position hasn't changed since
             creation of the SwipeDelegate, this property will be \c null.
+
+            \include qquickswipedelegate-item-lifetime.qdocinc
     \row
         \li transition
         \li This property holds the transition that is applied when a swipe is released,
@@ -1212,6 +1288,17 @@ void QQuickSwipeDelegate::geometryChanged(const QRectF &newGeometry, const QRect
     }
 }
 
+void QQuickSwipeDelegate::itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData &data)
+{
+    Q_D(QQuickSwipeDelegate);
+    QQuickItemDelegate::itemChange(change, data);
+
+    // A closed swipe that is moved to another view counts towards the pool of that view instead
+    QQuickSwipePrivate *swipePrivate = QQuickSwipePrivate::get(&d->swipe);
+    if (change == ItemParentHasChanged && swipePrivate->poolView && swipePrivate->poolView != data.item)
+        swipePrivate->addToPool();
+}
+
 QFont QQuickSwipeDelegate::defaultFont() const
 {
     return QQuickControlPrivate::themeFont(QPlatformTheme::ListViewFont);
@@ -80,6 +80,7 @@ protected:
     void touchEvent(QTouchEvent *event) override;
 
     void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &data) override;
 
     QFont defaultFont() const override;
 
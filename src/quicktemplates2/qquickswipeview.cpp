@@ -93,6 +93,15 @@ QT_BEGIN_NAMESPACE
     }
     \endcode
 
+    The amount of instantiated pages can be tuned by comparing the \l {SwipeView::index}{index}
+    of each page to the \l {Container::}{currentIndex} of the view. Pages
+    that are not current can be loaded \l {Loader::asynchronous}{asynchronously},
+    so that the pages ahead of the swipe are created in the background without
+    blocking the swipe itself. Only the \l {Loader}s, which are cheap, exist for
+    all pages. The following example keeps up to five pages instantiated.
+
+    \snippet qtquickcontrols2-swipeview-lazy.qml 1
+
     \note SwipeView takes over the geometry management of items added to the
           view. Using anchors on the items is not supported, and any \c width
           or \c height assignment will be overridden by the view. Notice that
@@ -110,11 +119,13 @@ class QQuickSwipeViewPrivate : public QQuickContainerPrivate
 public:
     void resizeItem(QQuickItem *item);
     void resizeItems();
+    void updateCurrentIndex();
 
     static QQuickSwipeViewPrivate *get(QQuickSwipeView *view);
 
     bool interactive = true;
     Qt::Orientation orientation = Qt::Horizontal;
+    int attachedCurrentIndex = -1;
 };
 
 class QQuickSwipeViewAttachedPrivate : public QObjectPrivate
@@ -159,6 +170,32 @@ void QQuickSwipeViewPrivate::resizeItems()
     }
 }
 
+static QQuickSwipeViewAttached *attachedSwipeView(QQuickItem *item, bool create = true)
+{
+    return qobject_cast<QQuickSwipeViewAttached *>(qmlAttachedPropertiesObject<QQuickSwipeView>(item, create));
+}
+
+void QQuickSwipeViewPrivate::updateCurrentIndex()
+{
+    Q_Q(QQuickSwipeView);
+    const int oldIndex = attachedCurrentIndex;
+    const int newIndex = q->currentIndex();
+    attachedCurrentIndex = newIndex;
+
+    // Only the items around the old and the new current index can change
+    // their current, next or previous status, so there's no need to notify
+    // the attached objects of all the other items. Notifying an attached
+    // object twice is harmless, as it ignores an unchanged current index.
+    const int count = q->count();
+    const int indexes[] = { oldIndex - 1, oldIndex, oldIndex + 1, newIndex - 1, newIndex, newIndex + 1 };
+    for (int index : indexes) {
+        if (index < 0 || index >= count)
+            continue;
+        if (QQuickSwipeViewAttached *attached = attachedSwipeView(itemAt(index), false))
+            QQuickSwipeViewAttachedPrivate::get(attached)->setCurrentIndex(newIndex);
+    }
+}
+
 QQuickSwipeViewPrivate *QQuickSwipeViewPrivate::get(QQuickSwipeView *view)
 {
     return view->d_func();
@@ -167,8 +204,10 @@ QQuickSwipeViewPrivate *QQuickSwipeViewPrivate::get(QQuickSwipeView *view)
 QQuickSwipeView::QQuickSwipeView(QQuickItem *parent)
     : QQuickContainer(*(new QQuickSwipeViewPrivate), parent)
 {
+    Q_D(QQuickSwipeView);
     setFlag(ItemIsFocusScope);
     setActiveFocusOnTab(true);
+    QObjectPrivate::connect(this, &QQuickContainer::currentIndexChanged, d, &QQuickSwipeViewPrivate::updateCurrentIndex);
 }
 
 /*!
@@ -274,22 +313,19 @@ void QQuickSwipeView::itemAdded(int index, QQuickItem *item)
     QQuickItemPrivate::get(item)->setCulled(true); // QTBUG-51078, QTBUG-51669
     if (isComponentComplete())
         item->setSize(QSizeF(d->contentItem->width(), d->contentItem->height()));
-    QQuickSwipeViewAttached *attached = qobject_cast<QQuickSwipeViewAttached *>(qmlAttachedPropertiesObject<QQuickSwipeView>(item));
-    if (attached)
+    if (QQuickSwipeViewAttached *attached = attachedSwipeView(item))
         QQuickSwipeViewAttachedPrivate::get(attached)->update(this, index);
 }
 
 void QQuickSwipeView::itemMoved(int index, QQuickItem *item)
 {
-    QQuickSwipeViewAttached *attached = qobject_cast<QQuickSwipeViewAttached *>(qmlAttachedPropertiesObject<QQuickSwipeView>(item));
-    if (attached)
+    if (QQuickSwipeViewAttached *attached = attachedSwipeView(item))
         QQuickSwipeViewAttachedPrivate::get(attached)->update(this, index);
 }
 
 void QQuickSwipeView::itemRemoved(int, QQuickItem *item)
 {
-    QQuickSwipeViewAttached *attached = qobject_cast<QQuickSwipeViewAttached *>(qmlAttachedPropertiesObject<QQuickSwipeView>(item));
-    if (attached)
+    if (QQuickSwipeViewAttached *attached = attachedSwipeView(item))
         QQuickSwipeViewAttachedPrivate::get(attached)->update(nullptr, -1);
 }
 
@@ -380,17 +416,8 @@ void QQuickSwipeViewAttachedPrivate::update(QQuickSwipeView *newView, int newInd
     index = newIndex;
     swipeView = newView;
 
-    if (oldView != newView) {
-        if (oldView) {
-            disconnect(oldView, &QQuickSwipeView::currentIndexChanged,
-                       this, &QQuickSwipeViewAttachedPrivate::updateCurrentIndex);
-        }
-        if (newView) {
-            connect(newView, &QQuickSwipeView::currentIndexChanged,
-                    this, &QQuickSwipeViewAttachedPrivate::updateCurrentIndex);
-        }
+    if (oldView != newView)
         emit q->viewChanged();
-    }
     if (oldIndex != newIndex)
         emit q->indexChanged();
 
@@ -272,8 +272,8 @@ void QQuickTextAreaPrivate::attachFlickable(QQuickFlickable *item)
     if (background)
         background->setParentItem(flickable);
 
-    QObjectPrivate::connect(q, &QQuickTextArea::contentSizeChanged, this, &QQuickTextAreaPrivate::resizeFlickableContent);
-    QObjectPrivate::connect(q, &QQuickTextEdit::cursorRectangleChanged, this, &QQuickTextAreaPrivate::ensureCursorVisible);
+    QObjectPrivate::connect(q, &QQuickTextArea::contentSizeChanged, this, &QQuickTextAreaPrivate::scheduleResizeFlickableContent);
+    QObjectPrivate::connect(q, &QQuickTextEdit::cursorRectangleChanged, this, &QQuickTextAreaPrivate::scheduleEnsureCursorVisible);
 
     QObject::connect(flickable, &QQuickFlickable::contentXChanged, q, &QQuickItem::update);
     QObject::connect(flickable, &QQuickFlickable::contentYChanged, q, &QQuickItem::update);
@@ -292,8 +292,8 @@ void QQuickTextAreaPrivate::detachFlickable()
     if (background && background->parentItem() == flickable)
         background->setParentItem(q);
 
-    QObjectPrivate::disconnect(q, &QQuickTextArea::contentSizeChanged, this, &QQuickTextAreaPrivate::resizeFlickableContent);
-    QObjectPrivate::disconnect(q, &QQuickTextEdit::cursorRectangleChanged, this, &QQuickTextAreaPrivate::ensureCursorVisible);
+    QObjectPrivate::disconnect(q, &QQuickTextArea::contentSizeChanged, this, &QQuickTextAreaPrivate::scheduleResizeFlickableContent);
+    QObjectPrivate::disconnect(q, &QQuickTextEdit::cursorRectangleChanged, this, &QQuickTextAreaPrivate::scheduleEnsureCursorVisible);
 
     QObject::disconnect(flickable, &QQuickFlickable::contentXChanged, q, &QQuickItem::update);
     QObject::disconnect(flickable, &QQuickFlickable::contentYChanged, q, &QQuickItem::update);
@@ -303,11 +303,21 @@ void QQuickTextAreaPrivate::detachFlickable()
     QObjectPrivate::disconnect(flickable, &QQuickFlickable::contentHeightChanged, this, &QQuickTextAreaPrivate::resizeFlickableControl);
 
     flickable = nullptr;
+    cursorVisibilityDirty = false;
+    flickableContentDirty = false;
+}
+
+void QQuickTextAreaPrivate::scheduleEnsureCursorVisible()
+{
+    Q_Q(QQuickTextArea);
+    cursorVisibilityDirty = true;
+    q->polish();
 }
 
 void QQuickTextAreaPrivate::ensureCursorVisible()
 {
     Q_Q(QQuickTextArea);
+    cursorVisibilityDirty = false;
     if (!flickable)
         return;
 
@@ -345,7 +355,7 @@ void QQuickTextAreaPrivate::ensureCursorVisible()
 void QQuickTextAreaPrivate::resizeFlickableControl()
 {
     Q_Q(QQuickTextArea);
-    if (!flickable)
+    if (!flickable || resizingFlickableContent)
         return;
 
     const qreal w = wrapMode == QQuickTextArea::NoWrap ? qMax(flickable->width(), flickable->contentWidth()) : flickable->width();
@@ -355,14 +365,29 @@ void QQuickTextAreaPrivate::resizeFlickableControl()
     resizeBackground();
 }
 
+void QQuickTextAreaPrivate::scheduleResizeFlickableContent()
+{
+    Q_Q(QQuickTextArea);
+    flickableContentDirty = true;
+    q->polish();
+}
+
 void QQuickTextAreaPrivate::resizeFlickableContent()
 {
     Q_Q(QQuickTextArea);
+    flickableContentDirty = false;
     if (!flickable)
         return;
 
+    // Resize the control once for both content dimensions, instead of
+    // once per dimension, to avoid an intermediate geometry change that
+    // would be propagated to the text edit for nothing.
+    resizingFlickableContent = true;
     flickable->setContentWidth(q->contentWidth() + q->leftPadding() + q->rightPadding());
     flickable->setContentHeight(q->contentHeight() + q->topPadding() + q->bottomPadding());
+    resizingFlickableContent = false;
+
+    resizeFlickableControl();
 }
 
 void QQuickTextAreaPrivate::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff)
@@ -430,12 +455,16 @@ QAccessible::Role QQuickTextAreaPrivate::accessibleRole() const
 }
 #endif
 
-static inline QString backgroundName() { return QStringLiteral("background"); }
+static inline int backgroundIndex()
+{
+    static const int index = QQuickTextArea::staticMetaObject.indexOfProperty("background");
+    return index;
+}
 
 void QQuickTextAreaPrivate::cancelBackground()
 {
     Q_Q(QQuickTextArea);
-    quickCancelDeferred(q, backgroundName());
+    quickCancelDeferred(q, backgroundIndex());
 }
 
 void QQuickTextAreaPrivate::executeBackground(bool complete)
@@ -445,9 +474,9 @@ void QQuickTextAreaPrivate::executeBackground(bool complete)
         return;
 
     if (!background || complete)
-        quickBeginDeferred(q, backgroundName(), background);
+        quickBeginDeferred(q, backgroundIndex(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
 }
 
 QQuickTextArea::QQuickTextArea(QQuickItem *parent)
@@ -760,6 +789,21 @@ void QQuickTextArea::geometryChanged(const QRectF &newGeometry, const QRectF &ol
     d->resizeBackground();
 }
 
+void QQuickTextArea::updatePolish()
+{
+    Q_D(QQuickTextArea);
+    QQuickTextEdit::updatePolish();
+
+    // The content size and the cursor rectangle may change several times
+    // per frame while typing, but querying the layout for them is costly
+    // in large documents. Resize the flickable content first, so that the
+    // cursor is made visible within the final content bounds.
+    if (d->flickableContentDirty)
+        d->resizeFlickableContent();
+    if (d->cursorVisibilityDirty)
+        d->ensureCursorVisible();
+}
+
 QSGNode *QQuickTextArea::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
 {
     Q_D(QQuickTextArea);
@@ -106,8 +106,10 @@ public:
 
     void attachFlickable(QQuickFlickable *flickable);
     void detachFlickable();
+    void scheduleEnsureCursorVisible();
     void ensureCursorVisible();
     void resizeFlickableControl();
+    void scheduleResizeFlickableContent();
     void resizeFlickableContent();
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
@@ -132,6 +134,9 @@ public:
     bool hovered = false;
     bool explicitHoverEnabled = false;
 #endif
+    bool resizingFlickableContent = false;
+    bool flickableContentDirty = false;
+    bool cursorVisibilityDirty = false;
 
     struct ExtraData {
         QFont requestedFont;
@@ -305,12 +305,16 @@ QAccessible::Role QQuickTextFieldPrivate::accessibleRole() const
 }
 #endif
 
-static inline QString backgroundName() { return QStringLiteral("background"); }
+static inline int backgroundIndex()
+{
+    static const int index = QQuickTextField::staticMetaObject.indexOfProperty("background");
+    return index;
+}
 
 void QQuickTextFieldPrivate::cancelBackground()
 {
     Q_Q(QQuickTextField);
-    quickCancelDeferred(q, backgroundName());
+    quickCancelDeferred(q, backgroundIndex());
 }
 
 void QQuickTextFieldPrivate::executeBackground(bool complete)
@@ -320,9 +324,9 @@ void QQuickTextFieldPrivate::executeBackground(bool complete)
         return;
 
     if (!background || complete)
-        quickBeginDeferred(q, backgroundName(), background);
+        quickBeginDeferred(q, backgroundIndex(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
 }
 
 QQuickTextField::QQuickTextField(QQuickItem *parent)
@@ -182,6 +182,20 @@ void QQuickTumblerPrivate::_q_updateItemWidths()
         childItem->setWidth(availableWidth);
 }
 
+/*
+    Sizes a single delegate \a item that was just added to the view.
+
+    The other delegates already have the correct size, so there is no
+    need to walk all of the view's children. This is done even while
+    ignoreSignals is set, because delegates created during a jump to a new
+    currentIndex would not be sized otherwise.
+*/
+void QQuickTumblerPrivate::updateItemSize(QQuickItem *item)
+{
+    Q_Q(const QQuickTumbler);
+    item->setSize(QSizeF(q->availableWidth(), delegateHeight(q)));
+}
+
 void QQuickTumblerPrivate::_q_onViewCurrentIndexChanged()
 {
     Q_Q(QQuickTumbler);
@@ -249,16 +263,9 @@ void QQuickTumblerPrivate::calculateDisplacements()
     }
 }
 
-void QQuickTumblerPrivate::itemChildAdded(QQuickItem *, QQuickItem *)
-{
-    _q_updateItemWidths();
-    _q_updateItemHeights();
-}
-
-void QQuickTumblerPrivate::itemChildRemoved(QQuickItem *, QQuickItem *)
+void QQuickTumblerPrivate::itemChildAdded(QQuickItem *, QQuickItem *child)
 {
-    _q_updateItemWidths();
-    _q_updateItemHeights();
+    updateItemSize(child);
 }
 
 void QQuickTumblerPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange change, const QRectF &)
@@ -760,6 +767,7 @@ void QQuickTumbler::keyPressEvent(QKeyEvent *event)
 void QQuickTumbler::updatePolish()
 {
     Q_D(QQuickTumbler);
+    QQuickControl::updatePolish();
     if (d->pendingCurrentIndex != -1) {
         // Update our count, as ignoreSignals might have been true
         // when _q_onViewCountChanged() was last called.
@@ -94,6 +94,7 @@ public:
 
     void _q_updateItemHeights();
     void _q_updateItemWidths();
+    void updateItemSize(QQuickItem *item);
     void _q_onViewCurrentIndexChanged();
     void _q_onViewCountChanged();
     void _q_onViewOffsetChanged();
@@ -118,7 +119,6 @@ public:
     void endSetModel();
 
     void itemChildAdded(QQuickItem *, QQuickItem *) override;
-    void itemChildRemoved(QQuickItem *, QQuickItem *) override;
     void itemGeometryChanged(QQuickItem *, QQuickGeometryChange , const QRectF &) override;
 };
 
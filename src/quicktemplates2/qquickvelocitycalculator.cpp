@@ -48,6 +48,7 @@ QT_BEGIN_NAMESPACE
     // ...
 
     velocityCalcular.startMeasuring(event->pos(), event->timestamp());
+    velocityCalcular.updateMeasuring(event->pos(), event->timestamp());
     velocityCalcular.stopMeasuring(event->pos(), event->timestamp());
 
     // ...
@@ -56,47 +57,110 @@ QT_BEGIN_NAMESPACE
         doSomething();
     else if (velocityCalculator.velocity().x() < -someAmount)
         doSomethingElse();
+
+    The velocity is estimated with a least-squares fit over the samples within
+    the last VelocityWindow milliseconds, so that a fast flick at the end of a
+    slow drag is not averaged away, and jitter of individual samples from high
+    rate touch input is smoothed out.
 */
 
-void QQuickVelocityCalculator::startMeasuring(const QPointF &point1, qint64 timestamp)
+static const qint64 VelocityWindow = 100; // ms
+
+void QQuickVelocityCalculator::startMeasuring(const QPointF &point, qint64 timestamp)
 {
-    m_point1 = point1;
+    reset();
 
-    if (timestamp != 0)
-        m_point1Timestamp = timestamp;
-    else
+    if (timestamp == 0)
         m_timer.start();
+
+    addSample(point, timestamp);
+}
+
+void QQuickVelocityCalculator::updateMeasuring(const QPointF &point, qint64 timestamp)
+{
+    if (m_sampleCount == 0)
+        return;
+
+    if (timestamp == 0) {
+        if (!m_timer.isValid())
+            return;
+        timestamp = m_timer.elapsed();
+    }
+
+    addSample(point, timestamp);
 }
 
-void QQuickVelocityCalculator::stopMeasuring(const QPointF &point2, qint64 timestamp)
+void QQuickVelocityCalculator::stopMeasuring(const QPointF &point, qint64 timestamp)
 {
-    if (timestamp == 0 && !m_timer.isValid()) {
+    if (m_sampleCount == 0 || (timestamp == 0 && !m_timer.isValid())) {
         qWarning() << "QQuickVelocityCalculator: a call to stopMeasuring() must be preceded by a call to startMeasuring()";
         return;
     }
 
-    m_point2 = point2;
-    m_point2Timestamp = timestamp != 0 ? timestamp : m_timer.elapsed();
+    addSample(point, timestamp != 0 ? timestamp : m_timer.elapsed());
     m_timer.invalidate();
 }
 
 void QQuickVelocityCalculator::reset()
 {
-    m_point1 = QPointF();
-    m_point2 = QPointF();
-    m_point1Timestamp = 0;
-    m_point2Timestamp = 0;
+    m_sampleCount = 0;
+    m_lastSample = -1;
     m_timer.invalidate();
 }
 
 QPointF QQuickVelocityCalculator::velocity() const
 {
-    if ((m_point2Timestamp == 0 || m_point1Timestamp == m_point2Timestamp) && !m_timer.isValid())
+    if (m_sampleCount < 2)
         return QPointF();
 
-    const qreal secondsElapsed = (m_point2Timestamp != 0 ? m_point2Timestamp - m_point1Timestamp : m_timer.elapsed()) / 1000.0;
-    const QPointF distance = m_point2 - m_point1;
-    return distance / secondsElapsed;
+    // Use the samples within the window, but at least two samples
+    // with different timestamps, so that a pause before the release
+    // results in a velocity of zero.
+    const Sample &last = sampleAt(0);
+    int count = 1;
+    for (; count < m_sampleCount; ++count) {
+        if (sampleAt(count - 1).timestamp != last.timestamp
+                && last.timestamp - sampleAt(count).timestamp > VelocityWindow) {
+            break;
+        }
+    }
+
+    qreal meanT = 0;
+    QPointF meanP;
+    for (int i = 0; i < count; ++i) {
+        const Sample &sample = sampleAt(i);
+        meanT += (sample.timestamp - last.timestamp) / 1000.0;
+        meanP += sample.point;
+    }
+    meanT /= count;
+    meanP /= count;
+
+    qreal stt = 0;
+    QPointF stp;
+    for (int i = 0; i < count; ++i) {
+        const Sample &sample = sampleAt(i);
+        const qreal dt = (sample.timestamp - last.timestamp) / 1000.0 - meanT;
+        stt += dt * dt;
+        stp += dt * (sample.point - meanP);
+    }
+
+    if (qFuzzyIsNull(stt))
+        return QPointF();
+
+    return stp / stt;
+}
+
+void QQuickVelocityCalculator::addSample(const QPointF &point, qint64 timestamp)
+{
+    m_lastSample = (m_lastSample + 1) % MaxSamples;
+    m_samples[m_lastSample] = { point, timestamp };
+    m_sampleCount = qMin(m_sampleCount + 1, int(MaxSamples));
+}
+
+const QQuickVelocityCalculator::Sample &QQuickVelocityCalculator::sampleAt(int age) const
+{
+    Q_ASSERT(age >= 0 && age < m_sampleCount);
+    return m_samples[(m_lastSample - age + MaxSamples) % MaxSamples];
 }
 
 QT_END_NAMESPACE
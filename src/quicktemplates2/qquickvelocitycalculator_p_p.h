@@ -50,24 +50,36 @@
 
 #include <QtCore/qpoint.h>
 #include <QtCore/qelapsedtimer.h>
+#include <QtQuickTemplates2/private/qtquicktemplates2global_p.h>
 
 QT_BEGIN_NAMESPACE
 
-class QQuickVelocityCalculator
+class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickVelocityCalculator
 {
 public:
-    void startMeasuring(const QPointF &point1, qint64 timestamp = 0);
-    void stopMeasuring(const QPointF &m_point2, qint64 timestamp = 0);
+    void startMeasuring(const QPointF &point, qint64 timestamp = 0);
+    void updateMeasuring(const QPointF &point, qint64 timestamp = 0);
+    void stopMeasuring(const QPointF &point, qint64 timestamp = 0);
     void reset();
     QPointF velocity() const;
 
 private:
-    QPointF m_point1;
-    QPointF m_point2;
-    qint64 m_point1Timestamp = 0;
-    qint64 m_point2Timestamp = 0;
+    struct Sample
+    {
+        QPointF point;
+        qint64 timestamp;
+    };
+
+    void addSample(const QPointF &point, qint64 timestamp);
+    const Sample &sampleAt(int age) const;
+
+    // The most recent samples are kept in a fixed-size ring buffer,
+    // so that the velocity reflects the end of the movement.
+    enum { MaxSamples = 16 };
+    Sample m_samples[MaxSamples];
+    int m_sampleCount = 0;
+    int m_lastSample = -1;
     // When a timestamp isn't available, we must use a timer.
-    // When stopMeasuring() has been called, we store the elapsed time in point2timestamp.
     QElapsedTimer m_timer;
 };
 
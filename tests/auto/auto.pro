@@ -21,11 +21,13 @@ SUBDIRS += \
     qquickmenu \
     qquickmenubar \
     qquickninepatchimage \
+    qquickplatformmenu \
     qquickpopup \
     qquickstyle \
     qquickstyleselector \
     qquickuniversalstyle \
     qquickuniversalstyleconf \
+    qquickvelocitycalculator \
     revisions \
     sanity \
     snippets
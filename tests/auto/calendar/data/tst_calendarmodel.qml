@@ -122,4 +122,38 @@ TestCase {
 
         inst.destroy()
     }
+
+    function test_range() {
+        var inst = instantiator.createObject(testCase)
+        verify(inst)
+        compare(inst.count, 12)
+
+        var march = inst.objectAt(2)
+        verify(march)
+        compare(march.month, 2)
+
+        // months are inserted and removed at the ends of the range without resetting the model
+        inst.model.to = new Date(2017, 2, 31)
+        compare(inst.count, 15)
+        compare(inst.objectAt(2), march)
+        compare(inst.objectAt(14).month, 2)
+        compare(inst.objectAt(14).year, 2017)
+
+        inst.model.from = new Date(2016, 1, 1)
+        compare(inst.count, 14)
+        compare(inst.objectAt(1), march)
+        compare(inst.objectAt(0).month, 1)
+
+        inst.model.from = new Date(2015, 11, 1)
+        compare(inst.count, 16)
+        compare(inst.objectAt(3), march)
+        compare(inst.objectAt(0).month, 11)
+        compare(inst.objectAt(0).year, 2015)
+
+        inst.model.to = new Date(2016, 2, 15)
+        compare(inst.count, 4)
+        compare(inst.objectAt(3), march)
+
+        inst.destroy()
+    }
 }
@@ -79,6 +79,17 @@ TestCase {
         }
     }
 
+    Component {
+        id: pressGrid
+        MonthGrid {
+            width: 280
+            height: 240
+            delegate: Item {
+                readonly property bool pressed: model.pressed
+            }
+        }
+    }
+
     Component {
         id: signalSpy
         SignalSpy { }
@@ -142,6 +153,34 @@ TestCase {
         control.destroy()
     }
 
+    function test_weekNumber() {
+        var control = delegateGrid.createObject(testCase, {month: 0, year: 2013})
+
+        // en_GB: the rows start on Monday, so each row is a single ISO week
+        control.locale = Qt.locale("en_GB")
+        compare(control.locale.name, "en_GB")
+
+        for (var i = 0; i < 42; ++i)
+            compare(control.contentItem.children[i].weekNumber, Math.floor(i / 7) + 1)
+
+        // en_US: the rows start on Sunday, so each row spans two ISO weeks
+        control.locale = Qt.locale("en_US")
+        compare(control.locale.name, "en_US")
+
+        //              S   M  T  W  T  F  S
+        var en_US = [  52,  1, 1, 1, 1, 1, 1,
+                        1,  2, 2, 2, 2, 2, 2,
+                        2,  3, 3, 3, 3, 3, 3,
+                        3,  4, 4, 4, 4, 4, 4,
+                        4,  5, 5, 5, 5, 5, 5,
+                        5,  6, 6, 6, 6, 6, 6]
+
+        for (var j = 0; j < 42; ++j)
+            compare(control.contentItem.children[j].weekNumber, en_US[j])
+
+        control.destroy()
+    }
+
     function test_range() {
         var control = defaultGrid.createObject(testCase)
 
@@ -280,4 +319,39 @@ TestCase {
             compare(clickedSpy.count, i + 1)
         }
     }
+
+    function test_pressed() {
+        var control = createTemporaryObject(pressGrid, testCase)
+        verify(control)
+
+        var pressedSpy = signalSpy.createObject(control, {target: control, signalName: "pressed"})
+        verify(pressedSpy.valid)
+
+        var releasedSpy = signalSpy.createObject(control, {target: control, signalName: "released"})
+        verify(releasedSpy.valid)
+
+        var first = control.contentItem.children[8]
+        var second = control.contentItem.children[9]
+
+        mousePress(first)
+        compare(pressedSpy.count, 1)
+        compare(first.pressed, true)
+        compare(second.pressed, false)
+
+        // moving within the same cell does not re-press it
+        mouseMove(first, first.width / 2 + 1, first.height / 2 + 1, -1, Qt.LeftButton)
+        compare(pressedSpy.count, 1)
+        compare(releasedSpy.count, 0)
+        compare(first.pressed, true)
+
+        mouseMove(second, second.width / 2, second.height / 2, -1, Qt.LeftButton)
+        compare(pressedSpy.count, 2)
+        compare(releasedSpy.count, 1)
+        compare(first.pressed, false)
+        compare(second.pressed, true)
+
+        mouseRelease(second)
+        compare(releasedSpy.count, 2)
+        compare(second.pressed, false)
+    }
 }
@@ -751,10 +751,10 @@ TestCase {
         // follow the control outside the horizontal window bounds
         control.x = -control.width / 2
         compare(control.x, -control.width / 2)
-        compare(control.popup.contentItem.parent.x, -control.width / 2)
+        tryCompare(control.popup.contentItem.parent, "x", -control.width / 2)
         control.x = testCase.width - control.width / 2
         compare(control.x, testCase.width - control.width / 2)
-        compare(control.popup.contentItem.parent.x, testCase.width - control.width / 2)
+        tryCompare(control.popup.contentItem.parent, "x", testCase.width - control.width / 2)
 
         // close the popup when hidden (QTBUG-67684)
         control.popup.open()
@@ -178,6 +178,43 @@ TestCase {
         compare(control.itemAt(3).objectName, "3")
     }
 
+    Component {
+        id: listModelContainer
+        Container {
+            property alias model: listModel
+            ListModel { id: listModel }
+            Repeater {
+                model: listModel
+                Item { objectName: name }
+            }
+        }
+    }
+
+    function test_reorder() {
+        var control = createTemporaryObject(listModelContainer, testCase)
+        verify(control)
+
+        // insertions at the beginning restack the Repeater's items
+        for (var i = 0; i < 5; ++i)
+            control.model.insert(0, {name: i.toString()})
+        compare(control.count, 5)
+        for (i = 0; i < 5; ++i)
+            compare(control.itemAt(i).objectName, (4 - i).toString())
+
+        control.currentIndex = 1
+        compare(control.currentItem.objectName, "3")
+
+        control.model.move(4, 0, 1)
+        compare(control.count, 5)
+        var expected = ["0", "4", "3", "2", "1"]
+        for (i = 0; i < 5; ++i)
+            compare(control.itemAt(i).objectName, expected[i])
+
+        // the current item follows the reordering
+        compare(control.currentIndex, 2)
+        compare(control.currentItem.objectName, "3")
+    }
+
     function test_removeTakeItem() {
         var control = createTemporaryObject(container, testCase)
         verify(control)
@@ -50,7 +50,7 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
+import QtQuick.Controls 2.4
 import QtQuick.Templates 2.2 as T
 
 TestCase {
@@ -81,6 +81,77 @@ TestCase {
         SignalSpy { }
     }
 
+    Component {
+        id: hiddenButton
+        Item {
+            property alias control: control
+            visible: false
+            Button {
+                id: control
+                lazyDelegates: true
+                background: Rectangle { implicitWidth: 200 }
+            }
+        }
+    }
+
+    Component {
+        id: hiddenCheckDelegate
+        Item {
+            property alias control: control
+            visible: false
+            CheckDelegate { id: control; text: "CheckDelegate"; lazyDelegates: true }
+        }
+    }
+
+    Component {
+        id: hiddenRadioDelegate
+        Item {
+            property alias control: control
+            visible: false
+            RadioDelegate { id: control; text: "RadioDelegate"; lazyDelegates: true }
+        }
+    }
+
+    Component {
+        id: hiddenSwitchDelegate
+        Item {
+            property alias control: control
+            visible: false
+            SwitchDelegate { id: control; text: "SwitchDelegate"; lazyDelegates: true }
+        }
+    }
+
+    Component {
+        id: completionOrder
+        T.AbstractButton {
+            id: control
+            property var log: []
+            indicator: Item { Component.onCompleted: control.log.push("indicator") }
+            background: Item { Component.onCompleted: control.log.push("background") }
+            contentItem: Item { Component.onCompleted: control.log.push("contentItem") }
+        }
+    }
+
+    Component {
+        id: eagerCompletionOrder
+        T.AbstractButton {
+            id: control
+            property var log: []
+            property real delegateWidth: 100
+            // read the delegates before the control is completed, like the styles do
+            implicitWidth: Math.max(background ? background.implicitWidth : 0, indicator ? indicator.implicitWidth : 0)
+            indicator: Item {
+                implicitWidth: control.delegateWidth / 2
+                Component.onCompleted: control.log.push("indicator")
+            }
+            background: Item {
+                implicitWidth: control.delegateWidth
+                Component.onCompleted: control.log.push("background")
+            }
+            contentItem: Item { Component.onCompleted: control.log.push("contentItem") }
+        }
+    }
+
     function test_padding() {
         var control = createTemporaryObject(component, testCase)
         verify(control)
@@ -936,4 +1007,101 @@ TestCase {
         compare(control.implicitWidth, 210)
         compare(control.implicitHeight, 220)
     }
+
+    function test_lazyDelegates() {
+        var page = createTemporaryObject(hiddenButton, testCase)
+        verify(page)
+
+        var control = page.control
+        compare(control.lazyDelegates, true)
+
+        var backgroundSpy = signalSpy.createObject(control, {target: control, signalName: "backgroundChanged"})
+        verify(backgroundSpy.valid)
+
+        // not created while hidden
+        verify(control.implicitWidth < 200)
+
+        page.visible = true
+        compare(backgroundSpy.count, 1)
+        verify(control.background)
+        compare(control.implicitWidth, 200)
+
+        page.visible = false
+        page.visible = true
+        compare(backgroundSpy.count, 1)
+
+        // reading the delegate creates it
+        page = createTemporaryObject(hiddenButton, testCase)
+        verify(page)
+
+        control = page.control
+        backgroundSpy.target = control
+        backgroundSpy.clear()
+
+        verify(control.background)
+        tryCompare(backgroundSpy, "count", 1)
+        tryCompare(control, "implicitWidth", 200)
+    }
+
+    function test_lazyIndicator_data() {
+        return [
+            { tag: "CheckDelegate", component: hiddenCheckDelegate },
+            { tag: "RadioDelegate", component: hiddenRadioDelegate },
+            { tag: "SwitchDelegate", component: hiddenSwitchDelegate }
+        ]
+    }
+
+    function test_lazyIndicator(data) {
+        var page = createTemporaryObject(data.component, testCase)
+        verify(page)
+
+        var control = page.control
+        compare(control.lazyDelegates, true)
+        verify(control.contentItem)
+
+        var indicatorSpy = signalSpy.createObject(control, {target: control, signalName: "indicatorChanged"})
+        verify(indicatorSpy.valid)
+
+        // the content item does not depend on the indicator while it does not exist
+        compare(control.contentItem.leftPadding, 0)
+        compare(control.contentItem.rightPadding, 0)
+
+        page.visible = true
+        compare(indicatorSpy.count, 1)
+        verify(control.indicator)
+        compare(control.contentItem.leftPadding, 0)
+        compare(control.contentItem.rightPadding, control.indicator.width + control.spacing)
+    }
+
+    function test_completionOrder() {
+        var control = createTemporaryObject(completionOrder, testCase)
+        verify(control)
+
+        // the delegates complete before the content item is created, as they did before they were batched
+        compare(control.log.length, 3)
+        verify(control.log.indexOf("indicator") !== -1)
+        verify(control.log.indexOf("background") !== -1)
+        compare(control.log[2], "contentItem")
+    }
+
+    function test_eagerCompletionOrder() {
+        var control = createTemporaryObject(eagerCompletionOrder, testCase)
+        verify(control)
+
+        // the delegates that were created on demand before completion are completed with the rest
+        compare(control.log.length, 3)
+        verify(control.log.indexOf("indicator") !== -1)
+        verify(control.log.indexOf("background") !== -1)
+        compare(control.log[2], "contentItem")
+
+        // and their own bindings are enabled
+        compare(control.background.implicitWidth, 100)
+        compare(control.indicator.implicitWidth, 50)
+        compare(control.implicitWidth, 100)
+
+        control.delegateWidth = 200
+        compare(control.background.implicitWidth, 200)
+        compare(control.indicator.implicitWidth, 100)
+        compare(control.implicitWidth, 200)
+    }
 }
@@ -312,16 +312,39 @@ TestCase {
 
         // moving parent outside margins triggers change notifiers
         control.parent.x = -50
-        compare(control.x, 50 + control.leftMargin)
+        tryCompare(control, "x", 50 + control.leftMargin)
         compare(xSpy.count, 3)
         compare(ySpy.count, 2)
 
         control.parent.y = -60
-        compare(control.y, 60 + control.topMargin)
+        tryCompare(control, "y", 60 + control.topMargin)
         compare(xSpy.count, 3)
         compare(ySpy.count, 3)
     }
 
+    function test_transformedAncestor() {
+        var ancestor = createTemporaryObject(rect, testCase, {x: 100, y: 100, width: 200, height: 200, scale: 0.5})
+        verify(ancestor)
+
+        var parentItem = rect.createObject(ancestor, {width: 50, height: 50})
+        verify(parentItem)
+
+        var control = popupControl.createObject(parentItem, {width: 20, height: 20})
+        verify(control)
+        control.open()
+        tryCompare(control, "opened", true)
+        verify(control.background)
+
+        var pos = control.background.mapToItem(null, 0, 0)
+
+        // resizing an ancestor that is scaled around its center moves its children
+        // in the scene, even though neither the ancestor nor the parent item moves
+        ancestor.width = 100
+        ancestor.height = 100
+        tryVerify(function() { return control.background.mapToItem(null, 0, 0).x === pos.x - 25 })
+        tryVerify(function() { return control.background.mapToItem(null, 0, 0).y === pos.y - 25 })
+    }
+
     function test_resetSize() {
         var control = createTemporaryObject(popupControl, testCase, {visible: true, margins: 0})
         verify(control)
@@ -109,7 +109,7 @@ TestCase {
         compare(vertical.height, container.height)
         // vertical scroll bar follows flickable's width
         container.width += 10
-        compare(vertical.x, container.width - vertical.width)
+        tryCompare(vertical, "x", container.width - vertical.width)
         vertical.implicitWidth -= 2
         compare(vertical.x, container.width - vertical.width)
         // ...unless explicitly positioned
@@ -139,7 +139,7 @@ TestCase {
         verify(horizontal.height > 0)
         // horizontal scroll bar follows flickable's height
         container.height += 10
-        compare(horizontal.y, container.height - horizontal.height)
+        tryCompare(horizontal, "y", container.height - horizontal.height)
         horizontal.implicitHeight -= 2
         compare(horizontal.y, container.height - horizontal.height)
         // ...unless explicitly positioned
@@ -186,6 +186,44 @@ TestCase {
         compare(horizontal.width, oldWidth)
     }
 
+    function test_resize() {
+        var container = createTemporaryObject(flickable, testCase)
+        verify(container)
+        waitForRendering(container)
+
+        var vertical = createTemporaryObject(scrollBar, null)
+        container.ScrollBar.vertical = vertical
+        compare(vertical.parent, container)
+        var horizontal = createTemporaryObject(scrollBar, null)
+        container.ScrollBar.horizontal = horizontal
+        compare(horizontal.parent, container)
+
+        var xSpy = signalSpy.createObject(vertical, {target: vertical, signalName: "xChanged"})
+        verify(xSpy.valid)
+        var heightSpy = signalSpy.createObject(vertical, {target: vertical, signalName: "heightChanged"})
+        verify(heightSpy.valid)
+        var ySpy = signalSpy.createObject(horizontal, {target: horizontal, signalName: "yChanged"})
+        verify(ySpy.valid)
+        var widthSpy = signalSpy.createObject(horizontal, {target: horizontal, signalName: "widthChanged"})
+        verify(widthSpy.valid)
+
+        // scroll bars are laid out once per frame, no matter how many times the flickable is resized
+        for (var i = 0; i < 10; ++i) {
+            container.width += 10
+            container.height += 10
+        }
+
+        tryCompare(vertical, "x", container.width - vertical.width)
+        tryCompare(vertical, "height", container.height)
+        tryCompare(horizontal, "y", container.height - horizontal.height)
+        tryCompare(horizontal, "width", container.width)
+
+        compare(xSpy.count, 1)
+        compare(heightSpy.count, 1)
+        compare(ySpy.count, 1)
+        compare(widthSpy.count, 1)
+    }
+
     function test_mouse_data() {
         return [
             { tag: "horizontal", properties: { visible: true, orientation: Qt.Horizontal, width: testCase.width } },
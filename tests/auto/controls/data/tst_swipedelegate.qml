@@ -1649,4 +1649,104 @@ TestCase {
             break;
         }
     }
+
+    Component {
+        id: swipeDelegateColumn
+        Column {
+            property alias repeater: repeater
+            Repeater {
+                id: repeater
+                model: 1000
+                SwipeDelegate {
+                    width: 100
+                    height: 10
+                    swipe.transition: null
+                    swipe.right: Rectangle { width: parent.width; height: parent.height }
+                }
+            }
+        }
+    }
+
+    function test_actionItemPool() {
+        var column = createTemporaryObject(swipeDelegateColumn, testCase)
+        verify(column)
+        compare(column.repeater.count, 1000)
+
+        function liveActionItems() {
+            var count = 0
+            for (var i = 0; i < column.repeater.count; ++i) {
+                if (column.repeater.itemAt(i).swipe.rightItem)
+                    ++count
+            }
+            return count
+        }
+
+        for (var i = 0; i < column.repeater.count; ++i) {
+            var control = column.repeater.itemAt(i)
+            control.swipe.open(SwipeDelegate.Right)
+            compare(control.swipe.position, -1.0)
+            verify(control.swipe.rightItem)
+            control.swipe.close()
+            compare(control.swipe.position, 0.0)
+            // the most recently closed swipes keep their action items
+            verify(control.swipe.rightItem)
+            if (i % 100 === 99)
+                verify(liveActionItems() <= 5)
+        }
+
+        // a released action item is created again when needed
+        var first = column.repeater.itemAt(0)
+        verify(!first.swipe.rightItem)
+        first.swipe.open(SwipeDelegate.Right)
+        verify(first.swipe.rightItem)
+        compare(first.swipe.position, -1.0)
+    }
+
+    Component {
+        id: swipeDelegateViews
+        Item {
+            property alias repeater: repeater
+            property alias otherView: otherView
+            Column {
+                Repeater {
+                    id: repeater
+                    model: 6
+                    SwipeDelegate {
+                        width: 100
+                        height: 10
+                        swipe.transition: null
+                        swipe.right: Rectangle { width: parent.width; height: parent.height }
+                    }
+                }
+            }
+            Item {
+                id: otherView
+            }
+        }
+    }
+
+    function test_actionItemPoolReparent() {
+        var views = createTemporaryObject(swipeDelegateViews, testCase)
+        verify(views)
+        compare(views.repeater.count, 6)
+
+        function swipeOpenAndClose(control) {
+            control.swipe.open(SwipeDelegate.Right)
+            compare(control.swipe.position, -1.0)
+            control.swipe.close()
+            compare(control.swipe.position, 0.0)
+            verify(control.swipe.rightItem)
+        }
+
+        var moved = views.repeater.itemAt(0)
+        for (var i = 0; i < 5; ++i)
+            swipeOpenAndClose(views.repeater.itemAt(i))
+
+        // the moved delegate no longer counts towards the pool of its old view
+        moved.parent = views.otherView
+        swipeOpenAndClose(views.repeater.itemAt(5))
+        verify(moved.swipe.rightItem)
+        for (i = 1; i < 6; ++i)
+            verify(views.repeater.itemAt(i).swipe.rightItem)
+    }
 }
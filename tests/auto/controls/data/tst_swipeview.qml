@@ -464,6 +464,79 @@ TestCase {
         }
     }
 
+    function test_attachedCurrentIndex() {
+        var control = createTemporaryObject(swipeView, testCase)
+
+        for (var i = 0; i < 10; ++i)
+            control.addItem(pageAttached.createObject(control, {text: i}))
+        compare(control.count, 10)
+
+        var spies = []
+        for (i = 0; i < control.count; ++i)
+            spies.push(signalSpy.createObject(control, {target: control.itemAt(i).SwipeView, signalName: "isCurrentItemChanged"}))
+
+        var indexes = [1, 8, 9, 0, 5, 4, 6]
+        for (var j = 0; j < indexes.length; ++j) {
+            var previousIndex = control.currentIndex
+            control.currentIndex = indexes[j]
+            for (i = 0; i < control.count; ++i) {
+                var page = control.itemAt(i)
+                compare(page.isCurrentItem, i === control.currentIndex)
+                compare(page.isNextItem, i === control.currentIndex + 1)
+                compare(page.isPreviousItem, i === control.currentIndex - 1)
+                // only the old and the new current item are notified
+                compare(spies[i].count, i === previousIndex || i === control.currentIndex ? 1 : 0)
+                spies[i].clear()
+            }
+        }
+    }
+
+    Component {
+        id: lazyView
+        SwipeView {
+            id: view
+            property alias repeater: repeater
+            Repeater {
+                id: repeater
+                model: 200
+                Loader {
+                    active: Math.abs(SwipeView.index - view.currentIndex) <= 2
+                    asynchronous: !SwipeView.isCurrentItem
+                    sourceComponent: Text { text: index }
+                }
+            }
+        }
+    }
+
+    function test_lazyLoading() {
+        var control = createTemporaryObject(lazyView, testCase)
+        verify(control)
+        compare(control.count, 200)
+
+        var indexes = [0, 1, 2, 50, 199, 198]
+        for (var j = 0; j < indexes.length; ++j) {
+            control.currentIndex = indexes[j]
+
+            // the current page is created synchronously
+            compare(control.currentItem.status, Loader.Ready)
+            compare(control.currentItem.item.text, String(indexes[j]))
+
+            var active = 0
+            for (var i = 0; i < control.count; ++i) {
+                var loader = control.itemAt(i)
+                var expected = Math.abs(i - control.currentIndex) <= 2
+                compare(loader.active, expected)
+                if (expected) {
+                    ++active
+                    tryCompare(loader, "status", Loader.Ready)
+                } else {
+                    compare(loader.item, null)
+                }
+            }
+            compare(active, Math.min(control.currentIndex, 2) + 1 + Math.min(control.count - control.currentIndex - 1, 2))
+        }
+    }
+
     Component {
         id: dynamicView
         SwipeView {
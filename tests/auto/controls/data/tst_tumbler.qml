@@ -1178,4 +1178,39 @@ TestCase {
         // 5 - 2 = 3
         compare(tumbler.currentIndex, 3);
     }
+
+    function test_largeModel_data() {
+        return [
+            { tag: "wrap", wrap: true },
+            { tag: "noWrap", wrap: false }
+        ];
+    }
+
+    function test_largeModel(data) {
+        createTumbler({ model: 10000, wrap: data.wrap });
+        compare(tumbler.count, 10000);
+        compare(tumbler.wrap, data.wrap);
+        tumblerView = findView(tumbler);
+        tryCompare(tumblerView, "count", 10000);
+
+        // Only the visible delegates plus a small cache should exist,
+        // no matter how large the model is.
+        var contentChildren = tumbler.wrap ? tumblerView.children : tumblerView.contentItem.children;
+        verify(contentChildren.length <= tumbler.visibleItemCount + 4);
+        for (var i = 0; i < contentChildren.length; ++i) {
+            compare(contentChildren[i].width, tumbler.availableWidth);
+            compare(contentChildren[i].height, tumblerDelegateHeight);
+        }
+
+        tumbler.currentIndex = 5000;
+        compare(tumbler.currentIndex, 5000);
+        tryCompare(tumbler, "moving", false);
+        contentChildren = tumbler.wrap ? tumblerView.children : tumblerView.contentItem.children;
+        verify(contentChildren.length <= tumbler.visibleItemCount + 4);
+        // The delegates created for the jump must be sized too.
+        for (i = 0; i < contentChildren.length; ++i) {
+            compare(contentChildren[i].width, tumbler.availableWidth);
+            compare(contentChildren[i].height, tumblerDelegateHeight);
+        }
+    }
 }
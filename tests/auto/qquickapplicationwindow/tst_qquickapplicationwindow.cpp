@@ -68,6 +68,7 @@ private slots:
     void defaultFocus();
     void implicitFill();
     void attachedProperties();
+    void attachedTracker();
     void font();
     void defaultFont();
     void locale();
@@ -499,6 +500,99 @@ void tst_QQuickApplicationWindow::attachedProperties()
     qApp->processEvents();
 }
 
+void tst_QQuickApplicationWindow::attachedTracker()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.loadUrl(testFileUrl("attachedTracker.qml"));
+
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(!object.isNull(), qPrintable(component.errorString()));
+
+    QQuickApplicationWindow *window = qobject_cast<QQuickApplicationWindow *>(object.data());
+    QVERIFY(window);
+
+    QQuickItem *textField1 = window->property("textField1").value<QQuickItem *>();
+    QVERIFY(textField1);
+    QQuickItem *textField2 = window->property("textField2").value<QQuickItem *>();
+    QVERIFY(textField2);
+    QQuickWindow *childWindow = window->property("childWindow").value<QQuickWindow *>();
+    QVERIFY(childWindow);
+    QQuickWindow *otherWindow = window->property("otherWindow").value<QQuickWindow *>();
+    QVERIFY(otherWindow);
+
+    // several attached objects share the tracker of the window
+    QVector<QPointer<QQuickItem> > items;
+    QVector<QPointer<QQuickApplicationWindowAttached> > attached;
+    for (int i = 0; i < 6; ++i) {
+        QQuickItem *item = new QQuickItem(window->contentItem());
+        QQuickApplicationWindowAttached *attachedObject = qobject_cast<QQuickApplicationWindowAttached *>(qmlAttachedPropertiesObject<QQuickApplicationWindow>(item));
+        QVERIFY(attachedObject);
+        QCOMPARE(attachedObject->window(), window);
+        items += item;
+        attached += attachedObject;
+    }
+
+    // destroy attached objects before and after the one being notified
+    QMetaObject::Connection connection = connect(attached.at(2), &QQuickApplicationWindowAttached::activeFocusControlChanged, [&]() {
+        delete items.at(1);
+        delete items.at(4);
+    });
+
+    window->show();
+    window->requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(window));
+
+    textField1->forceActiveFocus();
+    QTRY_COMPARE(window->activeFocusControl(), textField1);
+    QVERIFY(!items.at(1));
+    QVERIFY(!items.at(4));
+    for (int i : {0, 2, 3, 5})
+        QCOMPARE(attached.at(i)->activeFocusControl(), textField1);
+    disconnect(connection);
+
+    // the remaining attached objects are still notified after one is removed
+    delete items.at(0);
+    textField2->forceActiveFocus();
+    QTRY_COMPARE(window->activeFocusControl(), textField2);
+    for (int i : {2, 3, 5})
+        QCOMPARE(attached.at(i)->activeFocusControl(), textField2);
+
+    // move between an ApplicationWindow and a plain Window
+    QQuickItem *item = items.at(3);
+    QQuickApplicationWindowAttached *attachedObject = attached.at(3);
+    QSignalSpy windowSpy(attachedObject, &QQuickApplicationWindowAttached::windowChanged);
+    QVERIFY(windowSpy.isValid());
+    QSignalSpy contentItemSpy(attachedObject, &QQuickApplicationWindowAttached::contentItemChanged);
+    QVERIFY(contentItemSpy.isValid());
+
+    item->setParentItem(childWindow->contentItem());
+    QVERIFY(!attachedObject->window());
+    QVERIFY(!attachedObject->contentItem());
+    QVERIFY(!attachedObject->activeFocusControl());
+    QCOMPARE(windowSpy.count(), 1);
+    QCOMPARE(contentItemSpy.count(), 1);
+
+    // no contentItem change between plain windows
+    item->setParentItem(otherWindow->contentItem());
+    QVERIFY(!attachedObject->window());
+    QVERIFY(!attachedObject->contentItem());
+    QCOMPARE(windowSpy.count(), 2);
+    QCOMPARE(contentItemSpy.count(), 1);
+
+    item->setParentItem(window->contentItem());
+    QCOMPARE(attachedObject->window(), window);
+    QCOMPARE(attachedObject->contentItem(), window->contentItem());
+    QCOMPARE(attachedObject->activeFocusControl(), textField2);
+    QCOMPARE(windowSpy.count(), 3);
+    QCOMPARE(contentItemSpy.count(), 2);
+
+    textField1->forceActiveFocus();
+    QTRY_COMPARE(window->activeFocusControl(), textField1);
+    for (int i : {2, 3, 5})
+        QCOMPARE(attached.at(i)->activeFocusControl(), textField1);
+}
+
 void tst_QQuickApplicationWindow::font()
 {
     QQmlEngine engine;
@@ -854,23 +948,24 @@ void tst_QQuickApplicationWindow::layout()
     QCOMPARE(content->width(), qreal(window->width()));
     QCOMPARE(content->height(), window->height() - menuBar->height() - header->height() - footer->height());
 
+    // the window is laid out on the next polish
     menuBar->setVisible(false);
     QCOMPARE(content->x(), 0.0);
-    QCOMPARE(content->y(), header->height());
+    QTRY_COMPARE(content->y(), header->height());
     QCOMPARE(content->width(), qreal(window->width()));
-    QCOMPARE(content->height(), window->height() - header->height() - footer->height());
+    QTRY_COMPARE(content->height(), window->height() - header->height() - footer->height());
 
     header->setVisible(false);
     QCOMPARE(content->x(), 0.0);
-    QCOMPARE(content->y(), 0.0);
+    QTRY_COMPARE(content->y(), 0.0);
     QCOMPARE(content->width(), qreal(window->width()));
-    QCOMPARE(content->height(), window->height() - footer->height());
+    QTRY_COMPARE(content->height(), window->height() - footer->height());
 
     footer->setVisible(false);
     QCOMPARE(content->x(), 0.0);
     QCOMPARE(content->y(), 0.0);
     QCOMPARE(content->width(), qreal(window->width()));
-    QCOMPARE(content->height(), qreal(window->height()));
+    QTRY_COMPARE(content->height(), qreal(window->height()));
 }
 
 class FriendlyApplicationWindow : public QQuickApplicationWindow
@@ -29,10 +29,12 @@
 #include <QtCore/qvector.h>
 
 #include <qtest.h>
+#include <QtTest/qsignalspy.h>
 
 #include <QtQuick/qquickitem.h>
 #include <QtQuick/qquickview.h>
 #include <QtQuick/qquickitemgrabresult.h>
+#include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qquicktext_p.h>
 #include <QtQuickTemplates2/private/qquickicon_p.h>
 #include <QtQuickControls2/private/qquickiconimage_p.h>
@@ -43,6 +45,11 @@
 
 using namespace QQuickVisualTestUtil;
 
+static bool isPolishScheduled(QQuickItem *item)
+{
+    return QQuickItemPrivate::get(item)->polishScheduled;
+}
+
 class tst_qquickiconlabel : public QQmlDataTest
 {
     Q_OBJECT
@@ -56,6 +63,7 @@ private slots:
     void spacingWithOneDelegate();
     void emptyIconSource();
     void colorChanges();
+    void layoutCoalescing();
 };
 
 tst_qquickiconlabel::tst_qquickiconlabel()
@@ -153,6 +161,7 @@ void tst_qquickiconlabel::display()
     for (QQuickIconLabel::Display displayType : qAsConst(displayTypes)) {
         label->setDisplay(displayType);
         QCOMPARE(label->display(), displayType);
+        QTRY_VERIFY(!isPolishScheduled(label));
 
         QQuickIconImage *icon = label->findChild<QQuickIconImage *>();
         QQuickText *text = label->findChild<QQuickText *>();
@@ -289,6 +298,7 @@ void tst_qquickiconlabel::emptyIconSource()
     QVERIFY(icon->property("source").isValid());
     label->setIcon(QQuickIcon());
     QVERIFY(!label->findChild<QQuickIconImage *>());
+    QTRY_VERIFY(!isPolishScheduled(label));
     horizontalCenter = label->width() / 2;
     QCOMPARE(text->x(), horizontalCenter - text->width() / 2);
 }
@@ -324,6 +334,55 @@ void tst_qquickiconlabel::colorChanges()
     QVERIFY(grabResult->image() != enabledImageGrab);
 }
 
+void tst_qquickiconlabel::layoutCoalescing()
+{
+    QQuickView view(testFileUrl("iconlabel.qml"));
+    QCOMPARE(view.status(), QQuickView::Ready);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QQuickItem *rootItem = view.rootObject();
+    QVERIFY(rootItem);
+
+    QQuickIconLabel *label = rootItem->findChild<QQuickIconLabel *>();
+    QVERIFY(label);
+    // an explicit size, so that the changes below don't resize the label
+    label->setSize(QSizeF(200, 100));
+    QTRY_VERIFY(!isPolishScheduled(label));
+
+    QQuickText *text = label->findChild<QQuickText *>();
+    QVERIFY(text);
+    const qreal textX = text->x();
+
+    QSignalSpy xSpy(text, &QQuickItem::xChanged);
+    QVERIFY(xSpy.isValid());
+    QSignalSpy widthSpy(text, &QQuickItem::widthChanged);
+    QVERIFY(widthSpy.isValid());
+
+    // a burst of changes only schedules a layout...
+    label->setSpacing(10);
+    label->setMirrored(true);
+    label->setAlignment(Qt::AlignLeft);
+    label->setLeftPadding(5);
+    QVERIFY(isPolishScheduled(label));
+    QCOMPARE(text->x(), textX);
+    QCOMPARE(xSpy.count(), 0);
+
+    // ...and the text is moved once when polishing
+    QTRY_VERIFY(!isPolishScheduled(label));
+    QVERIFY(text->x() != textX);
+    QCOMPARE(xSpy.count(), 1);
+    QCOMPARE(widthSpy.count(), 0);
+
+    // a layout that doesn't change the geometry doesn't touch the text
+    label->setSpacing(10.5);
+    label->setSpacing(10);
+    QVERIFY(isPolishScheduled(label));
+    QTRY_VERIFY(!isPolishScheduled(label));
+    QCOMPARE(xSpy.count(), 1);
+    QCOMPARE(widthSpy.count(), 0);
+}
+
 QTEST_MAIN(tst_qquickiconlabel)
 
 #include "tst_qquickiconlabel.moc"
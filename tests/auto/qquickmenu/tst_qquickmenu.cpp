@@ -50,6 +50,7 @@
 #include <QtQuickTemplates2/private/qquickapplicationwindow_p.h>
 #include <QtQuickTemplates2/private/qquickoverlay_p.h>
 #include <QtQuickTemplates2/private/qquickbutton_p.h>
+#include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
 #include <QtQuickTemplates2/private/qquickmenu_p.h>
 #include <QtQuickTemplates2/private/qquickmenuitem_p.h>
 #include <QtQuickTemplates2/private/qquickmenuseparator_p.h>
@@ -84,6 +85,9 @@ private slots:
     void subMenuPosition_data();
     void subMenuPosition();
     void addRemoveSubMenus();
+    void preload();
+    void itemIndexes();
+    void itemWidth();
 };
 
 void tst_QQuickMenu::defaults()
@@ -1309,6 +1313,143 @@ void tst_QQuickMenu::addRemoveSubMenus()
     QVERIFY(subSubMenu1Item.isNull());
 }
 
+static bool hasPendingDelegates(QQuickItem *item)
+{
+    QQuickControl *control = qobject_cast<QQuickControl *>(item);
+    return control && QQuickControlPrivate::get(control)->pendingDelegates;
+}
+
+void tst_QQuickMenu::preload()
+{
+    QQuickApplicationHelper helper(this, QLatin1String("preload.qml"));
+    QQuickWindow *window = helper.window;
+
+    QQuickMenu *menu = window->property("menu").value<QQuickMenu *>();
+    QVERIFY(menu);
+    QCOMPARE(menu->count(), 3);
+
+    QQuickMenu *subMenu = window->property("subMenu").value<QQuickMenu *>();
+    QVERIFY(subMenu);
+    QCOMPARE(subMenu->count(), 2);
+
+    // the menu items of a hidden menu defer their lazy delegates
+    for (int i = 0; i < menu->count(); ++i)
+        QVERIFY(hasPendingDelegates(menu->itemAt(i)));
+    for (int i = 0; i < subMenu->count(); ++i)
+        QVERIFY(hasPendingDelegates(subMenu->itemAt(i)));
+
+    // ...until the menu preloads them when idle
+    window->show();
+    QVERIFY(QTest::qWaitForWindowActive(window));
+    for (int i = 0; i < menu->count(); ++i)
+        QTRY_VERIFY(!hasPendingDelegates(menu->itemAt(i)));
+
+    // sub-menu items are preloaded when the parent menu item is highlighted
+    QVERIFY(hasPendingDelegates(subMenu->itemAt(0)));
+    QVERIFY(hasPendingDelegates(subMenu->itemAt(1)));
+    menu->open();
+    QTRY_VERIFY(menu->isOpened());
+    menu->setCurrentIndex(2);
+    QTRY_VERIFY(!hasPendingDelegates(subMenu->itemAt(0)));
+    QTRY_VERIFY(!hasPendingDelegates(subMenu->itemAt(1)));
+    QVERIFY(!subMenu->isVisible());
+
+    menu->close();
+    QTRY_VERIFY(!menu->isVisible());
+
+    // preload() creates the pending delegates immediately
+    QQuickAction *action = new QQuickAction(menu);
+    menu->addAction(action);
+    QQuickItem *item = menu->itemAt(3);
+    QVERIFY(hasPendingDelegates(item));
+    menu->preload();
+    QVERIFY(!hasPendingDelegates(item));
+}
+
+static bool verifyItemIndexes(QQuickMenu *menu)
+{
+    menu->setCurrentIndex(-1);
+    for (int i = 0; i < menu->count(); ++i) {
+        QQuickItem *item = menu->itemAt(i);
+        item->forceActiveFocus();
+        if (!item->hasActiveFocus() || menu->currentIndex() != i) {
+            qWarning() << "item" << i << "has focus" << item->hasActiveFocus() << "current index" << menu->currentIndex();
+            return false;
+        }
+    }
+    return true;
+}
+
+void tst_QQuickMenu::itemIndexes()
+{
+    QQuickApplicationHelper helper(this, QLatin1String("actions.qml"));
+    QQuickWindow *window = helper.window;
+    window->show();
+    QVERIFY(QTest::qWaitForWindowActive(window));
+
+    QQuickMenu *menu = window->property("menu").value<QQuickMenu *>();
+    QVERIFY(menu);
+    menu->open();
+    QTRY_VERIFY(menu->isOpened());
+    QCOMPARE(menu->count(), 4);
+    QVERIFY(verifyItemIndexes(menu));
+
+    QQuickItem *item0 = menu->itemAt(0);
+    menu->moveItem(0, 3);
+    QCOMPARE(menu->itemAt(3), item0);
+    QVERIFY(verifyItemIndexes(menu));
+
+    QQuickMenuItem *newItem = new QQuickMenuItem;
+    menu->insertItem(1, newItem);
+    QCOMPARE(menu->itemAt(1), newItem);
+    QCOMPARE(menu->count(), 5);
+    QVERIFY(verifyItemIndexes(menu));
+
+    QQuickMenuItem *lastItem = new QQuickMenuItem;
+    menu->addItem(lastItem);
+    QCOMPARE(menu->itemAt(5), lastItem);
+    QVERIFY(verifyItemIndexes(menu));
+
+    menu->removeItem(lastItem);
+    QCOMPARE(menu->count(), 5);
+    QVERIFY(verifyItemIndexes(menu));
+
+    menu->removeItem(newItem);
+    QCOMPARE(menu->count(), 4);
+    QVERIFY(verifyItemIndexes(menu));
+}
+
+void tst_QQuickMenu::itemWidth()
+{
+    QQuickApplicationHelper helper(this, QLatin1String("actions.qml"));
+    QQuickWindow *window = helper.window;
+    window->show();
+    QVERIFY(QTest::qWaitForWindowActive(window));
+
+    QQuickMenu *menu = window->property("menu").value<QQuickMenu *>();
+    QVERIFY(menu);
+    QQuickItem *contentItem = menu->contentItem();
+    QVERIFY(contentItem);
+
+    QQuickItem *explicitItem = menu->itemAt(1);
+    QVERIFY(explicitItem);
+    explicitItem->setWidth(50);
+
+    // items without an explicit width follow the width of the menu
+    menu->setWidth(300);
+    QCOMPARE(contentItem->width(), menu->availableWidth());
+    for (int i = 0; i < menu->count(); ++i) {
+        QQuickItem *item = menu->itemAt(i);
+        QCOMPARE(item->width(), i == 1 ? 50 : contentItem->width());
+    }
+
+    // ...but not its height
+    QSignalSpy widthSpy(menu->itemAt(0), &QQuickItem::widthChanged);
+    QVERIFY(widthSpy.isValid());
+    menu->setHeight(300);
+    QCOMPARE(widthSpy.count(), 0);
+}
+
 QTEST_MAIN(tst_QQuickMenu)
 
 #include "tst_qquickmenu.moc"
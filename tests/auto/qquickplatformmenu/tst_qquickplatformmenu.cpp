@@ -0,0 +1,261 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/qtest.h>
+#include "../shared/util.h"
+
+#include <QtCore/qhash.h>
+#include <QtGui/qpa/qplatformmenu.h>
+#include <QtGui/qpa/qplatformtheme.h>
+#include <QtGui/private/qguiapplication_p.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlengine.h>
+
+class StubMenuItem : public QPlatformMenuItem
+{
+public:
+    StubMenuItem() { items.append(this); }
+    ~StubMenuItem() { items.removeOne(this); }
+
+    void setTag(quintptr tag) override { m_tag = tag; }
+    quintptr tag() const override { return m_tag; }
+    void setText(const QString &) override { ++calls["setText"]; }
+    void setIcon(const QIcon &i) override { ++calls["setIcon"]; icon = i; }
+    void setMenu(QPlatformMenu *) override { ++calls["setMenu"]; }
+    void setVisible(bool) override { ++calls["setVisible"]; }
+    void setIsSeparator(bool) override { ++calls["setIsSeparator"]; }
+    void setFont(const QFont &) override { ++calls["setFont"]; }
+    void setRole(MenuRole) override { ++calls["setRole"]; }
+    void setCheckable(bool) override { ++calls["setCheckable"]; }
+    void setChecked(bool) override { ++calls["setChecked"]; }
+#if QT_CONFIG(shortcut)
+    void setShortcut(const QKeySequence &) override { ++calls["setShortcut"]; }
+#endif
+    void setEnabled(bool) override { ++calls["setEnabled"]; }
+    void setIconSize(int) override { ++calls["setIconSize"]; }
+    void setHasExclusiveGroup(bool) override { ++calls["setHasExclusiveGroup"]; }
+
+    QHash<QByteArray, int> calls;
+    int syncs = 0;
+    QIcon icon;
+
+    static QList<StubMenuItem *> items;
+
+private:
+    quintptr m_tag = 0;
+};
+
+QList<StubMenuItem *> StubMenuItem::items;
+
+class StubMenu : public QPlatformMenu
+{
+public:
+    void insertMenuItem(QPlatformMenuItem *menuItem, QPlatformMenuItem *) override { m_items.append(menuItem); }
+    void removeMenuItem(QPlatformMenuItem *menuItem) override { m_items.removeOne(menuItem); }
+    void syncMenuItem(QPlatformMenuItem *menuItem) override { ++static_cast<StubMenuItem *>(menuItem)->syncs; }
+    void syncSeparatorsCollapsible(bool) override { }
+    void setTag(quintptr tag) override { m_tag = tag; }
+    quintptr tag() const override { return m_tag; }
+    void setText(const QString &) override { }
+    void setIcon(const QIcon &) override { }
+    void setEnabled(bool) override { }
+    void setVisible(bool) override { }
+    QPlatformMenuItem *menuItemAt(int position) const override { return m_items.value(position); }
+    QPlatformMenuItem *menuItemForTag(quintptr tag) const override
+    {
+        for (QPlatformMenuItem *item : m_items) {
+            if (item->tag() == tag)
+                return item;
+        }
+        return nullptr;
+    }
+
+private:
+    quintptr m_tag = 0;
+    QList<QPlatformMenuItem *> m_items;
+};
+
+class StubTheme : public QPlatformTheme
+{
+public:
+    QPlatformMenuItem *createPlatformMenuItem() const override { return new StubMenuItem; }
+    QPlatformMenu *createPlatformMenu() const override { return new StubMenu; }
+};
+
+class tst_QQuickPlatformMenu : public QQmlDataTest
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void sync();
+    void icons();
+
+private:
+    StubTheme m_theme;
+    QPlatformTheme *m_originalTheme = nullptr;
+};
+
+void tst_QQuickPlatformMenu::initTestCase()
+{
+    QQmlDataTest::initTestCase();
+
+    m_originalTheme = QGuiApplicationPrivate::platform_theme;
+    QGuiApplicationPrivate::platform_theme = &m_theme;
+}
+
+void tst_QQuickPlatformMenu::cleanupTestCase()
+{
+    QGuiApplicationPrivate::platform_theme = m_originalTheme;
+}
+
+void tst_QQuickPlatformMenu::sync()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("menu.qml"));
+    QScopedPointer<QObject> menu(component.create());
+    QVERIFY2(menu, qPrintable(component.errorString()));
+
+    QObject *first = menu->property("first").value<QObject *>();
+    QVERIFY(first);
+    QObject *second = menu->property("second").value<QObject *>();
+    QVERIFY(second);
+
+    QCOMPARE(StubMenuItem::items.count(), 2);
+    StubMenuItem *firstHandle = StubMenuItem::items.at(0);
+    StubMenuItem *secondHandle = StubMenuItem::items.at(1);
+
+    // every attribute is pushed exactly once when the menu is created
+    QCoreApplication::processEvents();
+    for (StubMenuItem *handle : qAsConst(StubMenuItem::items)) {
+        QCOMPARE(handle->syncs, 1);
+        QCOMPARE(handle->calls.value("setText"), 1);
+        QCOMPARE(handle->calls.value("setEnabled"), 1);
+        QCOMPARE(handle->calls.value("setChecked"), 1);
+        QCOMPARE(handle->calls.value("setShortcut"), 1);
+        QCOMPARE(handle->calls.value("setHasExclusiveGroup"), 1);
+    }
+
+    // consecutive changes are flushed once, and only the changed attributes are pushed
+    QVERIFY(first->setProperty("text", "1st"));
+    QVERIFY(first->setProperty("enabled", false));
+    QVERIFY(first->setProperty("checked", true));
+    QCOMPARE(firstHandle->syncs, 1);
+    QCOMPARE(firstHandle->calls.value("setText"), 1);
+
+    QCoreApplication::processEvents();
+    QCOMPARE(firstHandle->syncs, 2);
+    QCOMPARE(firstHandle->calls.value("setText"), 2);
+    QCOMPARE(firstHandle->calls.value("setEnabled"), 2);
+    QCOMPARE(firstHandle->calls.value("setChecked"), 2);
+    QCOMPARE(firstHandle->calls.value("setCheckable"), 2);
+    QCOMPARE(firstHandle->calls.value("setVisible"), 1);
+    QCOMPARE(firstHandle->calls.value("setFont"), 1);
+    QCOMPARE(firstHandle->calls.value("setShortcut"), 1);
+    QCOMPARE(firstHandle->calls.value("setHasExclusiveGroup"), 1);
+    QCOMPARE(secondHandle->syncs, 1);
+
+    // checking the other item of the exclusive group unchecks the first one
+    QVERIFY(second->setProperty("checked", true));
+    QCoreApplication::processEvents();
+    QCOMPARE(firstHandle->syncs, 3);
+    QCOMPARE(firstHandle->calls.value("setChecked"), 3);
+    QCOMPARE(firstHandle->calls.value("setText"), 2);
+    QCOMPARE(secondHandle->syncs, 2);
+    QCOMPARE(secondHandle->calls.value("setChecked"), 2);
+    QCOMPARE(secondHandle->calls.value("setShortcut"), 1);
+
+    // changing the menu itself does not re-sync its items
+    QVERIFY(menu->setProperty("title", "Title"));
+    QVERIFY(menu->setProperty("enabled", false));
+    QCoreApplication::processEvents();
+    QCOMPARE(firstHandle->syncs, 3);
+    QCOMPARE(secondHandle->syncs, 2);
+
+    QVERIFY(second->setProperty("shortcut", "Ctrl+X"));
+    QCoreApplication::processEvents();
+    QCOMPARE(secondHandle->syncs, 3);
+    QCOMPARE(secondHandle->calls.value("setShortcut"), 2);
+    QCOMPARE(secondHandle->calls.value("setText"), 1);
+}
+
+void tst_QQuickPlatformMenu::icons()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("icons.qml"));
+    QScopedPointer<QObject> menu(component.create());
+    QVERIFY2(menu, qPrintable(component.errorString()));
+
+    QObject *first = menu->property("first").value<QObject *>();
+    QVERIFY(first);
+    QObject *second = menu->property("second").value<QObject *>();
+    QVERIFY(second);
+
+    QCOMPARE(StubMenuItem::items.count(), 2);
+    StubMenuItem *firstHandle = StubMenuItem::items.at(0);
+    StubMenuItem *secondHandle = StubMenuItem::items.at(1);
+
+    const QSize maxSize(64, 64);
+
+    // the icon source is loaded asynchronously, and the handle is updated once it has finished
+    QTRY_COMPARE(firstHandle->icon.actualSize(maxSize), QSize(16, 16));
+    QVERIFY(secondHandle->icon.isNull());
+
+    // an icon that has already been produced is applied without loading it again
+    QVERIFY(second->setProperty("iconSource", testFileUrl("icon16.png")));
+    QCoreApplication::processEvents();
+    QCOMPARE(secondHandle->icon.actualSize(maxSize), QSize(16, 16));
+
+    // a pending load of a previous source does not override the current source
+    QVERIFY(first->setProperty("iconSource", testFileUrl("icon48.png")));
+    QVERIFY(first->setProperty("iconSource", testFileUrl("icon32.png")));
+    QTRY_COMPARE(firstHandle->icon.actualSize(maxSize), QSize(32, 32));
+    QTest::qWait(50);
+    QCOMPARE(firstHandle->icon.actualSize(maxSize), QSize(32, 32));
+
+    QVERIFY(first->setProperty("iconSource", testFileUrl("icon48.png")));
+    QVERIFY(first->setProperty("iconSource", QUrl()));
+    QCoreApplication::processEvents();
+    QVERIFY(firstHandle->icon.isNull());
+    QTest::qWait(50);
+    QVERIFY(firstHandle->icon.isNull());
+}
+
+QTEST_MAIN(tst_QQuickPlatformMenu)
+
+#include "tst_qquickplatformmenu.moc"
@@ -0,0 +1,14 @@
+CONFIG += testcase
+TARGET = tst_qquickvelocitycalculator
+SOURCES += tst_qquickvelocitycalculator.cpp
+
+macos:CONFIG -= app_bundle
+
+QT += core-private gui-private qml-private quick-private quicktemplates2-private testlib
+
+include (../shared/util.pri)
+
+TESTDATA = data/*
+
+OTHER_FILES += \
+    data/*.txt
@@ -0,0 +1,143 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/qtest.h>
+#include "../shared/util.h"
+
+#include <QtCore/qfile.h>
+#include <QtCore/qregularexpression.h>
+#include <QtQuickTemplates2/private/qquickvelocitycalculator_p_p.h>
+
+class tst_QQuickVelocityCalculator : public QQmlDataTest
+{
+    Q_OBJECT
+
+private slots:
+    void noSamples();
+    void stopWithoutStart();
+
+    void trace_data();
+    void trace();
+};
+
+void tst_QQuickVelocityCalculator::noSamples()
+{
+    QQuickVelocityCalculator calculator;
+    QCOMPARE(calculator.velocity(), QPointF());
+
+    calculator.startMeasuring(QPointF(10, 10), 1000);
+    QCOMPARE(calculator.velocity(), QPointF());
+
+    calculator.stopMeasuring(QPointF(20, 10), 1000);
+    QCOMPARE(calculator.velocity(), QPointF());
+
+    calculator.startMeasuring(QPointF(10, 10), 1000);
+    calculator.stopMeasuring(QPointF(20, 30), 1100);
+    QCOMPARE(calculator.velocity(), QPointF(100, 200));
+
+    calculator.reset();
+    QCOMPARE(calculator.velocity(), QPointF());
+}
+
+void tst_QQuickVelocityCalculator::stopWithoutStart()
+{
+    QQuickVelocityCalculator calculator;
+    QTest::ignoreMessage(QtWarningMsg, "QQuickVelocityCalculator: a call to stopMeasuring() must be preceded by a call to startMeasuring()");
+    calculator.stopMeasuring(QPointF(20, 10), 1000);
+    QCOMPARE(calculator.velocity(), QPointF());
+}
+
+void tst_QQuickVelocityCalculator::trace_data()
+{
+    QTest::addColumn<QString>("fileName");
+    QTest::addColumn<QPointF>("velocity");
+    QTest::addColumn<qreal>("tolerance");
+
+    // The average velocity over the whole drag would be 382 px/s
+    QTest::newRow("flick after slow drag") << QString("flick-after-slow-drag.txt") << QPointF(1875, 0) << qreal(10);
+    // The average velocity over the whole drag would be -400 px/s
+    QTest::newRow("pause before release") << QString("pause-before-release.txt") << QPointF(0, 0) << qreal(1);
+    // The movement is -1000 px/s along the y-axis with +/-2 px of jitter
+    QTest::newRow("jittery drag") << QString("jittery-drag.txt") << QPointF(0, -1000) << qreal(50);
+}
+
+// Replays a trace in the format that is produced by EventCapturer (tests/manual/gifs)
+void tst_QQuickVelocityCalculator::trace()
+{
+    QFETCH(QString, fileName);
+    QFETCH(QPointF, velocity);
+    QFETCH(qreal, tolerance);
+
+    QFile file(testFile(fileName));
+    QVERIFY2(file.open(QFile::ReadOnly | QFile::Text), qPrintable(file.errorString()));
+
+    static const QRegularExpression command(QStringLiteral(
+        "QTest::(mousePress|mouseMove|mouseRelease)\\(&view, (?:Qt::\\w+, Qt::\\w+, )?QPoint\\((-?\\d+), (-?\\d+)\\), (\\d+)\\);"));
+
+    QQuickVelocityCalculator calculator;
+    qint64 timestamp = 1000;
+    int events = 0;
+    while (!file.atEnd()) {
+        const QString line = QString::fromLatin1(file.readLine()).trimmed();
+        if (line.isEmpty())
+            continue;
+
+        const QRegularExpressionMatch match = command.match(line);
+        QVERIFY2(match.hasMatch(), qPrintable(line));
+
+        const QPointF point(match.capturedRef(2).toInt(), match.capturedRef(3).toInt());
+        timestamp += match.capturedRef(4).toInt();
+
+        const QStringRef type = match.capturedRef(1);
+        if (type == QLatin1String("mousePress"))
+            calculator.startMeasuring(point, timestamp);
+        else if (type == QLatin1String("mouseMove"))
+            calculator.updateMeasuring(point, timestamp);
+        else
+            calculator.stopMeasuring(point, timestamp);
+        ++events;
+    }
+    QVERIFY(events > 2);
+
+    const QPointF actual = calculator.velocity();
+    QVERIFY2(qAbs(actual.x() - velocity.x()) <= tolerance && qAbs(actual.y() - velocity.y()) <= tolerance,
+             qPrintable(QString("actual velocity (%1, %2), expected (%3, %4)")
+                        .arg(actual.x()).arg(actual.y()).arg(velocity.x()).arg(velocity.y())));
+}
+
+QTEST_MAIN(tst_QQuickVelocityCalculator)
+
+#include "tst_qquickvelocitycalculator.moc"
@@ -0,0 +1,115 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtQml>
+#include <QtQuick>
+#include <QtQuick/private/qquickwindow_p.h>
+#include <QtTest>
+
+static int layouts = 0;
+
+static void countLayouts(QtMsgType type, const QMessageLogContext &context, const QString &message)
+{
+    Q_UNUSED(type);
+    Q_UNUSED(message);
+    if (qstrcmp(context.category, "qt.quick.controls.applicationwindow.layout") == 0)
+        ++layouts;
+}
+
+class tst_ApplicationWindow : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void resize();
+
+private:
+    QQmlEngine engine;
+};
+
+void tst_ApplicationWindow::resize()
+{
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.11; import QtQuick.Layouts 1.3; import QtQuick.Controls 2.4\n"
+                      "ApplicationWindow {\n"
+                      "    width: 640; height: 480\n"
+                      "    menuBar: MenuBar { Menu { title: \"File\" } Menu { title: \"Edit\" } Menu { title: \"Help\" } }\n"
+                      "    header: ToolBar {\n"
+                      "        RowLayout {\n"
+                      "            anchors.fill: parent\n"
+                      "            Repeater { model: 50; ToolButton { text: index } }\n"
+                      "        }\n"
+                      "    }\n"
+                      "    footer: ToolBar { Label { text: \"Footer\" } }\n"
+                      "}", QUrl());
+
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object.data(), qPrintable(component.errorString()));
+
+    QQuickWindow *window = qobject_cast<QQuickWindow *>(object.data());
+    QVERIFY(window);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    // Each frame simulates a step of an interactive window resize:
+    // the window is resized, the header relayouts its tool buttons, and
+    // the window polishes its items.
+    auto frame = [window](int i) {
+        window->resize(640 + i % 100, 480 + i % 50);
+        QCoreApplication::processEvents();
+        QQuickWindowPrivate::get(window)->polishItems();
+    };
+
+    // Count the layouts of the window through its debug output, outside of
+    // the measurement so that formatting the messages does not skew it.
+    QLoggingCategory::setFilterRules(QStringLiteral("qt.quick.controls.applicationwindow.layout.debug=true"));
+    layouts = 0;
+    QtMessageHandler oldHandler = qInstallMessageHandler(countLayouts);
+    for (int i = 0; i < 1000; ++i)
+        frame(i);
+    qInstallMessageHandler(oldHandler);
+    QLoggingCategory::setFilterRules(QStringLiteral("qt.quick.controls.applicationwindow.layout.debug=false"));
+    qInfo("%d layouts in 1000 frames", layouts);
+
+    QBENCHMARK {
+        for (int i = 0; i < 1000; ++i)
+            frame(i);
+    }
+}
+
+QTEST_MAIN(tst_ApplicationWindow)
+
+#include "tst_applicationwindow.moc"
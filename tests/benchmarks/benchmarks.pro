@@ -1,4 +1,10 @@
 TEMPLATE = subdirs
 SUBDIRS += \
+    applicationwindow \
+    buttongroups \
+    containers \
     creationtime \
-    objectcount
+    menus \
+    objectcount \
+    popups \
+    textarea
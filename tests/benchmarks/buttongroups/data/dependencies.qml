@@ -0,0 +1,4 @@
+import QtQuick 2.11
+import QtQuick.Controls 2.4
+
+ButtonGroup { }
@@ -0,0 +1,123 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtQml>
+#include <QtQuick>
+#include <QtTest>
+
+class tst_ButtonGroups : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void setCheckState();
+    void toggleButtons();
+
+private:
+    QQmlEngine engine;
+    QScopedPointer<QObject> root;
+};
+
+void tst_ButtonGroups::initTestCase()
+{
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.11; import QtQuick.Controls 2.4\n"
+                      "Item {\n"
+                      "    property alias group: group\n"
+                      "    property alias repeater: repeater\n"
+                      "    ButtonGroup { id: group; exclusive: false }\n"
+                      "    Repeater {\n"
+                      "        id: repeater\n"
+                      "        model: 5000\n"
+                      "        CheckBox { ButtonGroup.group: group }\n"
+                      "    }\n"
+                      "}", QUrl());
+
+    root.reset(component.create());
+    QVERIFY2(root.data(), qPrintable(component.errorString()));
+}
+
+void tst_ButtonGroups::cleanupTestCase()
+{
+    root.reset();
+}
+
+void tst_ButtonGroups::setCheckState()
+{
+    QObject *group = root->property("group").value<QObject *>();
+    QVERIFY(group);
+
+    QBENCHMARK {
+        group->setProperty("checkState", Qt::Checked);
+        group->setProperty("checkState", Qt::Unchecked);
+    }
+
+    QCOMPARE(group->property("checkState").toInt(), int(Qt::Unchecked));
+}
+
+void tst_ButtonGroups::toggleButtons()
+{
+    QObject *group = root->property("group").value<QObject *>();
+    QQuickItem *repeater = root->property("repeater").value<QQuickItem *>();
+    QVERIFY(group);
+    QVERIFY(repeater);
+
+    QList<QQuickItem *> buttons;
+    for (int i = 0; i < repeater->property("count").toInt(); ++i) {
+        QQuickItem *button = nullptr;
+        QMetaObject::invokeMethod(repeater, "itemAt", Q_RETURN_ARG(QQuickItem *, button), Q_ARG(int, i));
+        buttons += button;
+    }
+    QCOMPARE(buttons.count(), 5000);
+
+    // Check and uncheck every button one by one, which updates
+    // the combined check state of the group on each toggle.
+    QBENCHMARK {
+        for (QQuickItem *button : qAsConst(buttons))
+            button->setProperty("checked", true);
+        for (QQuickItem *button : qAsConst(buttons))
+            button->setProperty("checked", false);
+    }
+
+    QCOMPARE(group->property("checkState").toInt(), int(Qt::Unchecked));
+}
+
+QTEST_MAIN(tst_ButtonGroups)
+
+#include "tst_buttongroups.moc"
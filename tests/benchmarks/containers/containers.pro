@@ -0,0 +1,9 @@
+TEMPLATE = app
+TARGET = tst_containers
+
+QT += qml quick testlib
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_containers.cpp
@@ -0,0 +1,80 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtQml>
+#include <QtQuick>
+#include <QtTest>
+
+class tst_Containers : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void reverseInsertion();
+
+private:
+    QQmlEngine engine;
+};
+
+void tst_Containers::reverseInsertion()
+{
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.11; import QtQuick.Controls 2.4\n"
+                      "Container {\n"
+                      "    ListModel { id: listModel }\n"
+                      "    Repeater { model: listModel; Item { } }\n"
+                      "    function populate(count) {\n"
+                      "        listModel.clear()\n"
+                      "        for (var i = 0; i < count; ++i)\n"
+                      "            listModel.insert(0, { value: i })\n"
+                      "    }\n"
+                      "}", QUrl());
+
+    QScopedPointer<QObject> container(component.create());
+    QVERIFY2(container.data(), qPrintable(component.errorString()));
+
+    // Every item is inserted at the beginning of the Repeater, which
+    // restacks it and makes the Container reorder its content model.
+    QBENCHMARK {
+        QMetaObject::invokeMethod(container.data(), "populate", Q_ARG(QVariant, 500));
+    }
+
+    QCOMPARE(container->property("count").toInt(), 500);
+}
+
+QTEST_MAIN(tst_Containers)
+
+#include "tst_containers.moc"
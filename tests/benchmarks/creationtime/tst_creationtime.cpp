@@ -62,6 +62,9 @@ private slots:
     void calendar();
     void calendar_data();
 
+    void buttons();
+    void buttons_data();
+
 private:
     QQmlEngine engine;
 };
@@ -194,6 +197,59 @@ void tst_CreationTime::calendar_data()
     addTestRows(&engine, "calendar", "Qt/labs/calendar");
 }
 
+static void addButtonRow(QQmlEngine *engine, const QString &name, const QString &targetPath)
+{
+    const auto importPathList = engine->importPathList();
+    for (const QString &importPath : importPathList) {
+        QString filePath = importPath + "/" + targetPath + "/Button.qml";
+        if (QFile::exists(filePath)) {
+            QTest::newRow(qPrintable(name)) << QUrl::fromLocalFile(filePath);
+            break;
+        } else {
+            filePath = QQmlFile::urlToLocalFileOrQrc(filePath);
+            if (!filePath.isEmpty() && QFile::exists(filePath)) {
+                QTest::newRow(qPrintable(name)) << QUrl(filePath);
+                break;
+            }
+        }
+    }
+}
+
+void tst_CreationTime::buttons()
+{
+    QFETCH(QUrl, url);
+
+    // create 1000 buttons in a single pass to measure the per-object overhead
+    // of executing the deferred delegates of the controls
+    QQmlComponent button(&engine);
+    button.loadUrl(url);
+    QVERIFY2(button.isReady(), qPrintable(button.errorString()));
+
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.0; Item { id: root; property Component button; Repeater { model: 1000; delegate: root.button } }", QUrl());
+
+    QObjectList objects;
+    QBENCHMARK {
+        QObject *object = component.beginCreate(engine.rootContext());
+        QVERIFY2(object, qPrintable(component.errorString()));
+        object->setProperty("button", QVariant::fromValue(&button));
+        component.completeCreate();
+        objects += object;
+    }
+
+    qDeleteAll(objects);
+}
+
+void tst_CreationTime::buttons_data()
+{
+    QTest::addColumn<QUrl>("url");
+    addButtonRow(&engine, "default", "QtQuick/Controls.2");
+    addButtonRow(&engine, "fusion", "QtQuick/Controls.2/Fusion");
+    addButtonRow(&engine, "imagine", "QtQuick/Controls.2/Imagine");
+    addButtonRow(&engine, "material", "QtQuick/Controls.2/Material");
+    addButtonRow(&engine, "universal", "QtQuick/Controls.2/Universal");
+}
+
 QTEST_MAIN(tst_CreationTime)
 
 #include "tst_creationtime.moc"
@@ -0,0 +1,9 @@
+TEMPLATE = app
+TARGET = tst_menus
+
+QT += qml quick testlib quick-private
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_menus.cpp
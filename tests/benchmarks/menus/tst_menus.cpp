@@ -0,0 +1,151 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtQml>
+#include <QtQuick>
+#include <QtQuick/private/qquickwindow_p.h>
+#include <QtTest>
+
+class tst_Menus : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void creation();
+    void creation_data();
+
+    void firstOpen();
+    void firstOpen_data();
+
+private:
+    QQmlEngine engine;
+};
+
+static const int menuItemCount = 200;
+
+static QByteArray generateMenu(int count, bool lazy)
+{
+    QByteArray data = "import QtQuick 2.11; import QtQuick.Controls 2.4\n"
+                      "Menu {\n"
+                      "    enter: null; exit: null\n"
+                      "    delegate: MenuItem { lazyDelegates: ";
+    data += lazy ? "true" : "false";
+    data += " }\n";
+    for (int i = 0; i < count; ++i)
+        data += "    Action { text: \"Action " + QByteArray::number(i) + "\" }\n";
+    data += "}\n";
+    return data;
+}
+
+void tst_Menus::init()
+{
+    engine.clearComponentCache();
+}
+
+void tst_Menus::creation_data()
+{
+    QTest::addColumn<bool>("lazy");
+
+    QTest::newRow("eager") << false;
+    QTest::newRow("lazy") << true;
+}
+
+void tst_Menus::creation()
+{
+    QFETCH(bool, lazy);
+
+    QQmlComponent component(&engine);
+    component.setData(generateMenu(menuItemCount, lazy), QUrl());
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+
+    QBENCHMARK {
+        QScopedPointer<QObject> menu(component.create());
+        QVERIFY(menu);
+    }
+}
+
+void tst_Menus::firstOpen_data()
+{
+    QTest::addColumn<bool>("lazy");
+    QTest::addColumn<bool>("preload");
+
+    QTest::newRow("eager") << false << false;
+    QTest::newRow("lazy") << true << false;
+    QTest::newRow("lazy,preloaded") << true << true;
+}
+
+// Measures how long it takes to open a freshly created menu and to lay out
+// its items, excluding the time spent on creating and preloading the menu.
+void tst_Menus::firstOpen()
+{
+    QFETCH(bool, lazy);
+    QFETCH(bool, preload);
+
+    QQuickWindow window;
+    window.resize(640, 480);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    QQmlComponent component(&engine);
+    component.setData(generateMenu(menuItemCount, lazy), QUrl());
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+
+    const int iterations = 20;
+    qint64 elapsed = 0;
+    for (int i = 0; i < iterations; ++i) {
+        QScopedPointer<QObject> menu(component.create());
+        QVERIFY(menu);
+        menu->setProperty("parent", QVariant::fromValue(window.contentItem()));
+        if (preload)
+            QVERIFY(QMetaObject::invokeMethod(menu.data(), "preload"));
+
+        QElapsedTimer timer;
+        timer.start();
+        QVERIFY(QMetaObject::invokeMethod(menu.data(), "open"));
+        QQuickWindowPrivate::get(&window)->polishItems();
+        elapsed += timer.nsecsElapsed();
+
+        QVERIFY(menu->property("opened").toBool());
+    }
+
+    QTest::setBenchmarkResult(elapsed / 1000000.0 / iterations, QTest::WalltimeMilliseconds);
+}
+
+QTEST_MAIN(tst_Menus)
+
+#include "tst_menus.moc"
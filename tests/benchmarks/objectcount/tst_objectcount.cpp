@@ -67,6 +67,9 @@ private slots:
     void qquickitems();
     void qquickitems_data();
 
+    void hiddenPage();
+    void hiddenPage_data();
+
 private:
     QQmlEngine engine;
 };
@@ -182,6 +185,44 @@ void tst_ObjectCount::qquickitems_data()
     initTestRows(&engine);
 }
 
+void tst_ObjectCount::hiddenPage()
+{
+    QFETCH(bool, lazy);
+
+    QQmlComponent component(&engine);
+    component.setData(QString::fromLatin1(
+        "import QtQuick 2.0; import QtQuick.Controls 2.4\n"
+        "Item {\n"
+        "    visible: false\n"
+        "    Column {\n"
+        "        Repeater { model: 100; Button { lazyDelegates: %1 } }\n"
+        "        Repeater { model: 100; CheckBox { lazyDelegates: %1 } }\n"
+        "        Repeater { model: 100; Slider { lazyDelegates: %1 } }\n"
+        "        Repeater { model: 100; ComboBox { lazyDelegates: %1 } }\n"
+        "        Repeater { model: 100; SpinBox { lazyDelegates: %1 } }\n"
+        "    }\n"
+        "}").arg(lazy ? "true" : "false").toUtf8(), QUrl());
+
+    qt_qobjects->clear();
+
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object.data(), qPrintable(component.errorString()));
+
+    if (qt_verbose) {
+        for (QObject *object : qAsConst(*qt_qobjects()))
+            qInfo() << "\t" << object;
+    }
+
+    QTest::setBenchmarkResult(qt_qobjects->count(), QTest::Events);
+}
+
+void tst_ObjectCount::hiddenPage_data()
+{
+    QTest::addColumn<bool>("lazy");
+    QTest::newRow("eager") << false;
+    QTest::newRow("lazy") << true;
+}
+
 QTEST_MAIN(tst_ObjectCount)
 
 #include "tst_objectcount.moc"
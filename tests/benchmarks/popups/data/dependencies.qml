@@ -0,0 +1,5 @@
+import QtQuick 2.11
+import QtQuick.Window 2.2
+import QtQuick.Controls 2.4
+
+Popup { }
@@ -0,0 +1,9 @@
+TEMPLATE = app
+TARGET = tst_popups
+
+QT += qml quick testlib quick-private
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_popups.cpp
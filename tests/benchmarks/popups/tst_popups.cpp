@@ -0,0 +1,141 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtQml>
+#include <QtQuick>
+#include <QtQuick/private/qquickwindow_p.h>
+#include <QtTest>
+
+class tst_Popups : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void mouseMove();
+    void parentMove();
+
+private:
+    QQmlEngine engine;
+};
+
+static void sendMouseEvent(QWindow *window, QEvent::Type type, const QPointF &pos)
+{
+    const Qt::MouseButtons buttons = type == QEvent::MouseButtonRelease ? Qt::NoButton : Qt::LeftButton;
+    QMouseEvent event(type, pos, pos, pos, Qt::LeftButton, buttons, Qt::NoModifier);
+    QGuiApplication::sendEvent(window, &event);
+}
+
+void tst_Popups::mouseMove()
+{
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.11; import QtQuick.Window 2.2; import QtQuick.Controls 2.4\n"
+                      "Window {\n"
+                      "    width: 640; height: 480\n"
+                      "    Repeater {\n"
+                      "        model: 50\n"
+                      "        Item {\n"
+                      "            Popup { x: index * 4; y: index * 4; width: 200; height: 200; closePolicy: Popup.NoAutoClose; visible: true }\n"
+                      "        }\n"
+                      "    }\n"
+                      "}", QUrl());
+
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object.data(), qPrintable(component.errorString()));
+
+    QQuickWindow *window = qobject_cast<QQuickWindow *>(object.data());
+    QVERIFY(window);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    // Press inside the topmost popup so that it grabs the mouse and the
+    // moves are filtered by the overlay on their way to the popup.
+    const QPointF pos(300, 300);
+    sendMouseEvent(window, QEvent::MouseButtonPress, pos);
+
+    int i = 0;
+    QBENCHMARK {
+        sendMouseEvent(window, QEvent::MouseMove, pos + QPointF(i % 2, 0));
+        ++i;
+    }
+
+    sendMouseEvent(window, QEvent::MouseButtonRelease, pos);
+}
+
+void tst_Popups::parentMove()
+{
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.11; import QtQuick.Window 2.2; import QtQuick.Controls 2.4\n"
+                      "Window {\n"
+                      "    width: 640; height: 480\n"
+                      "    property alias container: container\n"
+                      "    Item {\n"
+                      "        id: container\n"
+                      "        width: 400; height: 400\n"
+                      "        Repeater {\n"
+                      "            model: 20\n"
+                      "            Item {\n"
+                      "                x: index * 10; y: index * 10; width: 20; height: 20\n"
+                      "                Popup { y: parent.height; width: 100; height: 20; closePolicy: Popup.NoAutoClose; visible: true }\n"
+                      "            }\n"
+                      "        }\n"
+                      "    }\n"
+                      "}", QUrl());
+
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object.data(), qPrintable(component.errorString()));
+
+    QQuickWindow *window = qobject_cast<QQuickWindow *>(object.data());
+    QVERIFY(window);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    QQuickItem *container = window->property("container").value<QQuickItem *>();
+    QVERIFY(container);
+
+    // Each iteration simulates an animation frame: the container is moved
+    // a couple of times before the window polishes its items.
+    int i = 0;
+    QBENCHMARK {
+        container->setX(i % 100);
+        container->setY(i % 100);
+        QQuickWindowPrivate::get(window)->polishItems();
+        ++i;
+    }
+}
+
+QTEST_MAIN(tst_Popups)
+
+#include "tst_popups.moc"
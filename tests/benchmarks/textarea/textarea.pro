@@ -0,0 +1,9 @@
+TEMPLATE = app
+TARGET = tst_textarea
+
+QT += qml quick testlib
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_textarea.cpp
@@ -0,0 +1,218 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtQml>
+#include <QtQuick>
+#include <QtTest>
+
+class tst_TextArea : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void load();
+    void load_data();
+
+    void scroll();
+    void scroll_data();
+
+    void typing();
+    void typing_data();
+
+private:
+    QQuickWindow *createWindow();
+
+    QQmlEngine engine;
+    QScopedPointer<QObject> object;
+};
+
+static QString generateText(int megabytes)
+{
+    const QString line = QStringLiteral("The quick brown fox jumps over the lazy dog. 0123456789 abcdefghijklmnopqrstuvwxyz\n");
+    const int lines = megabytes * 1024 * 1024 / line.size();
+
+    QString text;
+    text.reserve(lines * line.size());
+    for (int i = 0; i < lines; ++i)
+        text += line;
+    return text;
+}
+
+static void addSizeRows()
+{
+    QTest::addColumn<int>("megabytes");
+
+    QTest::newRow("1MB") << 1;
+    QTest::newRow("10MB") << 10;
+    QTest::newRow("50MB") << 50;
+}
+
+static bool waitForFrame(QQuickWindow *window)
+{
+    QSignalSpy swapped(window, &QQuickWindow::frameSwapped);
+    window->update();
+    return swapped.wait();
+}
+
+void tst_TextArea::init()
+{
+    object.reset();
+    engine.clearComponentCache();
+}
+
+QQuickWindow *tst_TextArea::createWindow()
+{
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.11; import QtQuick.Window 2.2; import QtQuick.Controls 2.4\n"
+                      "Window {\n"
+                      "    width: 640; height: 480\n"
+                      "    property alias flickable: flickable\n"
+                      "    property alias textArea: textArea\n"
+                      "    Flickable {\n"
+                      "        id: flickable\n"
+                      "        anchors.fill: parent\n"
+                      "        TextArea.flickable: TextArea { id: textArea; wrapMode: TextArea.Wrap }\n"
+                      "    }\n"
+                      "}", QUrl());
+
+    object.reset(component.create());
+    if (!object)
+        qWarning() << component.errorString();
+    return qobject_cast<QQuickWindow *>(object.data());
+}
+
+void tst_TextArea::load()
+{
+    QFETCH(int, megabytes);
+
+    QQuickWindow *window = createWindow();
+    QVERIFY(window);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    QQuickItem *textArea = window->property("textArea").value<QQuickItem *>();
+    QVERIFY(textArea);
+
+    const QString text = generateText(megabytes);
+
+    // Measures the layout of the document and the first frame showing it.
+    QBENCHMARK_ONCE {
+        textArea->setProperty("text", text);
+        QVERIFY(waitForFrame(window));
+    }
+}
+
+void tst_TextArea::load_data()
+{
+    addSizeRows();
+}
+
+void tst_TextArea::scroll()
+{
+    QFETCH(int, megabytes);
+
+    QQuickWindow *window = createWindow();
+    QVERIFY(window);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    QQuickItem *flickable = window->property("flickable").value<QQuickItem *>();
+    QVERIFY(flickable);
+    QQuickItem *textArea = window->property("textArea").value<QQuickItem *>();
+    QVERIFY(textArea);
+
+    textArea->setProperty("text", generateText(megabytes));
+    QVERIFY(waitForFrame(window));
+
+    // Scrolls from the beginning to the end of the document in a fixed
+    // number of steps, rendering a frame at each step.
+    const int steps = 100;
+    const qreal range = flickable->property("contentHeight").toReal() - flickable->height();
+    QVERIFY(range > 0);
+
+    QBENCHMARK {
+        for (int i = 0; i <= steps; ++i) {
+            flickable->setProperty("contentY", range * i / steps);
+            QVERIFY(waitForFrame(window));
+        }
+    }
+}
+
+void tst_TextArea::scroll_data()
+{
+    addSizeRows();
+}
+
+void tst_TextArea::typing()
+{
+    QFETCH(bool, atEnd);
+
+    QQuickWindow *window = createWindow();
+    QVERIFY(window);
+    window->show();
+    window->requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(window));
+
+    QQuickItem *textArea = window->property("textArea").value<QQuickItem *>();
+    QVERIFY(textArea);
+
+    const QString line = QStringLiteral("The quick brown fox jumps over the lazy dog.\n");
+    textArea->setProperty("text", line.repeated(100000));
+    textArea->setProperty("cursorPosition", atEnd ? textArea->property("length").toInt() : 0);
+    textArea->forceActiveFocus();
+    QVERIFY(textArea->hasActiveFocus());
+    QVERIFY(waitForFrame(window));
+
+    // Each iteration is one keystroke followed by the frame showing it.
+    QBENCHMARK {
+        QTest::keyClick(window, Qt::Key_A);
+        QVERIFY(waitForFrame(window));
+    }
+}
+
+void tst_TextArea::typing_data()
+{
+    QTest::addColumn<bool>("atEnd");
+
+    QTest::newRow("start") << false;
+    QTest::newRow("end") << true;
+}
+
+QTEST_MAIN(tst_TextArea)
+
+#include "tst_textarea.moc"